@@ -1,7 +1,9 @@
 #ifndef BH_NODE_HPP
 #define BH_NODE_HPP
 
-class BH_Node {
+#include "PriorityQueue.hpp"
+
+class BH_Node : public PQ_Handle {
 public:
     int key;
     int degree;
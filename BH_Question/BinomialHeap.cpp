@@ -6,11 +6,13 @@
 
 using namespace std;
 
-// Merges two binomial trees of the same degree
+// Merges two binomial trees of the same degree. If the minimum root is
+// linked under a root with an equal key, that root takes over as minimum.
 BH_Node* BinomialHeap::mergeTrees(BH_Node* t1, BH_Node* t2) {
     if (t1->key > t2->key) {
         swap(t1, t2);
     }
+    if (t2 == minRoot) minRoot = t1;
 
     t2->parent = t1;
     t2->sibling = t1->child;
@@ -20,36 +22,49 @@ BH_Node* BinomialHeap::mergeTrees(BH_Node* t1, BH_Node* t2) {
     return t1;
 }
 
-// Merges two binomial heaps
+// Merges two binomial heaps: their root lists are merged by degree, then
+// adjacent trees of equal degree are linked so each degree appears once
 BH_Node* BinomialHeap::mergeHeaps(BH_Node* h1, BH_Node* h2) {
     if (!h1) return h2;
     if (!h2) return h1;
 
-    BH_Node *dummy = new BH_Node(INT_MIN), *tail = dummy;
+    // tail is the link the next tree goes into, so no dummy head is needed
+    BH_Node* newHead = nullptr;
+    BH_Node** tail = &newHead;
     BH_Node *t1 = h1, *t2 = h2;
 
     while (t1 && t2) {
-        if (t1->degree < t2->degree) {
-            tail->sibling = t1;
+        if (t1->degree <= t2->degree) {
+            *tail = t1;
             t1 = t1->sibling;
-        } else if (t1->degree > t2->degree) {
-            tail->sibling = t2;
-            t2 = t2->sibling;
         } else {
-            BH_Node* merged = mergeTrees(t1, t2);
-            tail->sibling = merged;
-            t1 = t1->sibling;
+            *tail = t2;
             t2 = t2->sibling;
         }
-        tail = tail->sibling;
+        tail = &(*tail)->sibling;
     }
 
     // Append remaining trees
-    if (t1) tail->sibling = t1;
-    if (t2) tail->sibling = t2;
+    *tail = t1 ? t1 : t2;
 
-    BH_Node* newHead = dummy->sibling;
-    delete dummy;
+    // Link equal-degree neighbours. With three in a row, the first is left
+    // alone so the last two are linked and the result stays in degree order.
+    BH_Node* prev = nullptr;
+    BH_Node* curr = newHead;
+    BH_Node* next = curr->sibling;
+    while (next) {
+        if (curr->degree != next->degree || (next->sibling && next->sibling->degree == curr->degree)) {
+            prev = curr;
+            curr = next;
+        } else {
+            BH_Node* after = next->sibling;
+            curr = mergeTrees(curr, next);
+            curr->sibling = after;
+            if (prev) prev->sibling = curr;
+            else newHead = curr;
+        }
+        next = curr->sibling;
+    }
 
     return newHead;
 }
@@ -59,77 +74,66 @@ void BinomialHeap::consolidate() {
     if (!head) return;
 
     vector<BH_Node*> degrees(32, nullptr);
-    BH_Node* prev = nullptr;
     BH_Node* curr = head;
-    BH_Node* next = nullptr;
 
     while (curr) {
-        next = curr->sibling;
+        BH_Node* next = curr->sibling;
+        curr->sibling = nullptr;
         int d = curr->degree;
 
         while (degrees[d]) {
-            BH_Node* other = degrees[d];
-            if (other->key < curr->key) {
-                swap(curr, other);
-            }
-
-            if (curr->sibling == other) {
-                curr->sibling = other->sibling;
-            }
-
-            mergeTrees(curr, other);
+            curr = mergeTrees(curr, degrees[d]);
             degrees[d] = nullptr;
             d++;
         }
 
         degrees[d] = curr;
-        prev = curr;
         curr = next;
     }
 
+    // Relink the trees in increasing degree order
     head = nullptr;
+    BH_Node* tail = nullptr;
     for (int i = 0; i < 32; i++) {
         if (degrees[i]) {
-            if (!head) {
-                head = degrees[i];
-            } else {
-                head = mergeHeaps(head, degrees[i]);
-            }
+            if (!head) head = degrees[i];
+            else tail->sibling = degrees[i];
+            tail = degrees[i];
         }
     }
 }
 
 // Insert a new key into the heap
-void BinomialHeap::insert(int key) {
+BH_Node* BinomialHeap::insertWithHandle(int key) {
     // Create a new node
     BH_Node* newNode = new BH_Node(key);
-    
+    if (!minRoot || key < minRoot->key) minRoot = newNode;
+
     // Merge the new node with the existing heap
     head = mergeHeaps(head, newNode);
+    return newNode;
 }
 
-// Extract the minimum key from the heap
-int BinomialHeap::extractMin() {
-    if (!head) return INT_MIN;
-
-    BH_Node* minNode = head;
-    BH_Node* minPrev = nullptr;
-    BH_Node* prev = nullptr;
-    BH_Node* curr = head;
-
-    while (curr) {
-        if (curr->key < minNode->key) {
-            minNode = curr;
-            minPrev = prev;
+// Rescan the root list for the minimum, after the root that held it is gone
+void BinomialHeap::findMinRoot() {
+    minRoot = head;
+    for (BH_Node* curr = head; curr; curr = curr->sibling) {
+        if (curr->key < minRoot->key) {
+            minRoot = curr;
         }
-        prev = curr;
-        curr = curr->sibling;
     }
+}
 
-    if (minPrev) minPrev->sibling = minNode->sibling;
-    else head = minNode->sibling;
+// Unlink a root from the root list, merge its children back in and find the
+// new minimum
+void BinomialHeap::removeRoot(BH_Node* root) {
+    BH_Node** slot = &head;
+    while (*slot != root) {
+        slot = &(*slot)->sibling;
+    }
+    *slot = root->sibling;
 
-    BH_Node* child = minNode->child;
+    BH_Node* child = root->child;
     BH_Node* reversedChild = nullptr;
 
     while (child) {
@@ -141,7 +145,16 @@ int BinomialHeap::extractMin() {
     }
 
     head = mergeHeaps(head, reversedChild);
-    
+    findMinRoot();
+}
+
+// Extract the minimum key from the heap
+int BinomialHeap::extractMin() {
+    if (!head) return INT_MIN;
+
+    BH_Node* minNode = minRoot;
+    removeRoot(minNode);
+
     int minValue = minNode->key;
     delete minNode;
     return minValue;
@@ -149,26 +162,91 @@ int BinomialHeap::extractMin() {
 
 // Get the minimum key without removing it
 int BinomialHeap::getMin() {
-    if (!head) return INT_MIN;
-    BH_Node* curr = head;
-    int minVal = INT_MAX;
-
-    while (curr) {
-        minVal = min(minVal, curr->key);
-        curr = curr->sibling;
-    }
-
-    return minVal;
+    return minRoot ? minRoot->key : INT_MIN;
 }
 
 // Union of two binomial heaps
 void BinomialHeap::unionHeaps(BinomialHeap& other) {
+    if (other.minRoot && (!minRoot || other.minRoot->key < minRoot->key)) {
+        minRoot = other.minRoot;
+    }
     head = mergeHeaps(head, other.head);
     other.head = nullptr;
+    other.minRoot = nullptr;
     consolidate();
 }
 
-// Decrease the key of a node
+// Swap a node with its parent by relinking: the node takes its parent's
+// place in the parent's sibling list and inherits the parent's children,
+// with the parent standing in the node's old slot among them; the parent
+// takes over the node's children. Walks and re-points the two child lists,
+// each of at most log n nodes.
+void BinomialHeap::swapWithParent(BH_Node* node) {
+    BH_Node* parent = node->parent;
+    BH_Node* grandparent = parent->parent;
+
+    BH_Node* nodePrev = nullptr;
+    for (BH_Node* c = parent->child; c != node; c = c->sibling) {
+        nodePrev = c;
+    }
+    BH_Node** parentSlot = grandparent ? &grandparent->child : &head;
+    while (*parentSlot != parent) {
+        parentSlot = &(*parentSlot)->sibling;
+    }
+
+    BH_Node* nodeChild = node->child;
+    BH_Node* nodeSibling = node->sibling;
+
+    // The node takes the parent's place
+    *parentSlot = node;
+    if (parent == minRoot) minRoot = node;
+    node->sibling = parent->sibling;
+    node->parent = grandparent;
+
+    // The parent takes the node's place among its own old children
+    if (nodePrev) {
+        nodePrev->sibling = parent;
+        node->child = parent->child;
+    } else {
+        node->child = parent;
+    }
+    parent->sibling = nodeSibling;
+    parent->child = nodeChild;
+    swap(node->degree, parent->degree);
+
+    for (BH_Node* c = node->child; c; c = c->sibling) c->parent = node;
+    for (BH_Node* c = parent->child; c; c = c->sibling) c->parent = parent;
+}
+
+// Decrease the key of a node, then move it up past larger parents: at most
+// log n swaps. The node itself moves, so every handle still refers to its
+// own key.
+void BinomialHeap::decreaseKey(PQ_Handle* handle, int newKey) {
+    BH_Node* node = static_cast<BH_Node*>(handle);
+    if (newKey > node->key) {
+        std::cout << "New key is greater than the old key. Cannot decrease.\n";
+        return;
+    }
+
+    node->key = newKey;
+    while (node->parent && node->key < node->parent->key) {
+        swapWithParent(node);
+    }
+    if (!node->parent && node->key < minRoot->key) minRoot = node;
+}
+
+// Remove a node: it is moved up to be a root, as if its key were smaller
+// than every other, then removed like the minimum
+void BinomialHeap::erase(PQ_Handle* handle) {
+    BH_Node* node = static_cast<BH_Node*>(handle);
+    while (node->parent) {
+        swapWithParent(node);
+    }
+    removeRoot(node);
+    delete node;
+}
+
+// Decrease the key of a node found by key
 void BinomialHeap::decreaseKey(int oldKey, int newKey) {
     if (newKey > oldKey) {
         std::cout << "New key is greater than the old key. Cannot decrease.\n";
@@ -181,22 +259,18 @@ void BinomialHeap::decreaseKey(int oldKey, int newKey) {
         return;
     }
 
-    // Decrease the key
-    node->key = newKey;
-
-    // Percolate up the tree to restore heap property
-    BH_Node* parent = node->parent;
-    while (parent && node->key < parent->key) {
-        std::swap(node->key, parent->key);
-        node = parent;
-        parent = parent->parent;
-    }
+    decreaseKey(node, newKey);
 }
 
 // Delete a key from the heap
 void BinomialHeap::deleteKey(int key) {
-    decreaseKey(key, INT_MIN);  // Decrease the key to the smallest possible value
-    extractMin();  // Now extract the minimum (which is the deleted key)
+    BH_Node* node = findNode(head, key);
+    if (!node) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    erase(node);
 }
 
 // Helper function to print binomial heap (in order)
@@ -223,7 +297,7 @@ BH_Node* BinomialHeap::findNode(BH_Node* root, int key) {
     return findNode(root->sibling, key);
 }
 
-BinomialHeap::BinomialHeap() : head(nullptr) {}
+BinomialHeap::BinomialHeap() : head(nullptr), minRoot(nullptr) {}
 
 void BinomialHeap::print() {
     printHeap(head);
@@ -2,26 +2,36 @@
 #define BINOMIALHEAP_HPP
 
 #include "BH_Node.hpp"
+#include "PriorityQueue.hpp"
 
-class BinomialHeap {
+class BinomialHeap : public HandlePriorityQueue {
 private:
-    BH_Node* head;  // Head of the linked list of binomial trees
+    BH_Node* head;     // Head of the linked list of binomial trees
+    BH_Node* minRoot;  // Root holding the minimum key, or nullptr if empty
 
     BH_Node* mergeTrees(BH_Node* t1, BH_Node* t2);
     BH_Node* mergeHeaps(BH_Node* h1, BH_Node* h2);
     void consolidate();
     void printHeap(BH_Node* root);
     BH_Node* findNode(BH_Node* root, int key);
+    void swapWithParent(BH_Node* node);
+    void removeRoot(BH_Node* root);
+    void findMinRoot();
 
 public:
     BinomialHeap();
     
-    void insert(int key);
+    // The returned node is the key's handle: decreaseKey and erase move
+    // nodes by relinking them, never by swapping keys between them
+    BH_Node* insertWithHandle(int key);
     int extractMin();
     int getMin();
     void unionHeaps(BinomialHeap& other);
+    void decreaseKey(PQ_Handle* handle, int newKey);
+    void erase(PQ_Handle* handle);
     void decreaseKey(int oldKey, int newKey);
     void deleteKey(int key);
+    bool empty() { return head == nullptr; }
     void print();
 };
 
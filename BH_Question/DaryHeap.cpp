@@ -0,0 +1,108 @@
+#include "DaryHeap.hpp"
+#include <iostream>
+
+using namespace std;
+
+// Move the key at i up until its parent is no larger
+void DaryHeap::siftUp(size_t i) {
+    int key = keys[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / ARITY;
+        if (keys[parent] <= key) break;
+        keys[i] = keys[parent];
+        i = parent;
+    }
+    keys[i] = key;
+}
+
+// Move the key at i down until none of its children is smaller
+void DaryHeap::siftDown(size_t i) {
+    int key = keys[i];
+    size_t n = keys.size();
+    while (true) {
+        size_t first = ARITY * i + 1;
+        if (first >= n) break;
+
+        size_t last = first + ARITY < n ? first + ARITY : n;
+        size_t smallest = first;
+        for (size_t c = first + 1; c < last; c++) {
+            if (keys[c] < keys[smallest]) smallest = c;
+        }
+        if (keys[smallest] >= key) break;
+        keys[i] = keys[smallest];
+        i = smallest;
+    }
+    keys[i] = key;
+}
+
+// Index of a key (for Decrease Key and Delete), or keys.size() if absent
+size_t DaryHeap::findIndex(int key) {
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i] == key) return i;
+    }
+    return keys.size();
+}
+
+// Insert a new key into the heap
+void DaryHeap::insert(int key) {
+    keys.push_back(key);
+    siftUp(keys.size() - 1);
+}
+
+// Extract the minimum key from the heap
+int DaryHeap::extractMin() {
+    if (keys.empty()) return INT_MIN;
+
+    int minValue = keys[0];
+    keys[0] = keys.back();
+    keys.pop_back();
+    if (!keys.empty()) siftDown(0);
+    return minValue;
+}
+
+// Get the minimum key without removing it
+int DaryHeap::getMin() {
+    return keys.empty() ? INT_MIN : keys[0];
+}
+
+// Decrease the key of a node
+void DaryHeap::decreaseKey(int oldKey, int newKey) {
+    if (newKey > oldKey) {
+        std::cout << "New key is greater than the old key. Cannot decrease.\n";
+        return;
+    }
+
+    size_t i = findIndex(oldKey);
+    if (i == keys.size()) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    keys[i] = newKey;
+    siftUp(i);
+}
+
+// Delete a key from the heap: the last key fills its slot and moves
+// whichever way restores the heap
+void DaryHeap::deleteKey(int key) {
+    size_t i = findIndex(key);
+    if (i == keys.size()) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    keys[i] = keys.back();
+    keys.pop_back();
+    if (i < keys.size()) {
+        siftUp(i);
+        siftDown(i);
+    }
+}
+
+// Print the keys in array (level) order
+void DaryHeap::print() {
+    for (size_t i = 0; i < keys.size(); i++) {
+        std::cout << keys[i] << " ";
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,35 @@
+#ifndef DARYHEAP_HPP
+#define DARYHEAP_HPP
+
+#include "PriorityQueue.hpp"
+#include <cstddef>
+#include <vector>
+
+// Implicit 4-ary min-heap in one contiguous array: the children of index i
+// are 4i + 1 .. 4i + 4. Four children to a parent halves the tree height of
+// a binary heap, and the four sibling keys compared in siftDown share a
+// cache line. No allocation per insert beyond the array's growth.
+//
+// It has no handles, which would cost a slot per key and a second array
+// written on every sift step. IndexedDaryHeap is the 4-ary engine with them.
+class DaryHeap final : public PriorityQueue {
+private:
+    static const int ARITY = 4;
+
+    std::vector<int> keys;
+
+    void siftUp(size_t i);
+    void siftDown(size_t i);
+    size_t findIndex(int key);
+
+public:
+    void insert(int key);
+    int extractMin();
+    int getMin();
+    void decreaseKey(int oldKey, int newKey);
+    void deleteKey(int key);
+    bool empty() { return keys.empty(); }
+    void print();
+};
+
+#endif // DARYHEAP_HPP
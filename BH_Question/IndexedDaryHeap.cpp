@@ -0,0 +1,145 @@
+#include "IndexedDaryHeap.hpp"
+#include <iostream>
+
+using namespace std;
+
+// Put a key and its handle at index i
+void IndexedDaryHeap::place(size_t i, int key, DH_Slot* slot) {
+    keys[i] = key;
+    slots[i] = slot;
+    slot->index = i;
+}
+
+// Move the key at i up until its parent is no larger
+void IndexedDaryHeap::siftUp(size_t i) {
+    int key = keys[i];
+    DH_Slot* slot = slots[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / ARITY;
+        if (keys[parent] <= key) break;
+        place(i, keys[parent], slots[parent]);
+        i = parent;
+    }
+    place(i, key, slot);
+}
+
+// Move the key at i down until none of its children is smaller
+void IndexedDaryHeap::siftDown(size_t i) {
+    int key = keys[i];
+    DH_Slot* slot = slots[i];
+    size_t n = keys.size();
+    while (true) {
+        size_t first = ARITY * i + 1;
+        if (first >= n) break;
+
+        size_t last = first + ARITY < n ? first + ARITY : n;
+        size_t smallest = first;
+        for (size_t c = first + 1; c < last; c++) {
+            if (keys[c] < keys[smallest]) smallest = c;
+        }
+        if (keys[smallest] >= key) break;
+        place(i, keys[smallest], slots[smallest]);
+        i = smallest;
+    }
+    place(i, key, slot);
+}
+
+// Remove the key at i: the last key fills its slot and moves whichever way
+// restores the heap
+void IndexedDaryHeap::removeAt(size_t i) {
+    pool.release(slots[i]);
+    size_t last = keys.size() - 1;
+    if (i < last) {
+        place(i, keys[last], slots[last]);
+    }
+    keys.pop_back();
+    slots.pop_back();
+    if (i < last) {
+        siftUp(i);
+        siftDown(i);
+    }
+}
+
+// Index of a key (for Decrease Key and Delete), or keys.size() if absent
+size_t IndexedDaryHeap::findIndex(int key) {
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i] == key) return i;
+    }
+    return keys.size();
+}
+
+// Insert a new key into the heap
+PQ_Handle* IndexedDaryHeap::insertWithHandle(int key) {
+    DH_Slot* slot = pool.allocate();
+    keys.push_back(key);
+    slots.push_back(slot);
+    slot->index = keys.size() - 1;
+    siftUp(keys.size() - 1);
+    return slot;
+}
+
+// Extract the minimum key from the heap
+int IndexedDaryHeap::extractMin() {
+    if (keys.empty()) return INT_MIN;
+
+    int minValue = keys[0];
+    removeAt(0);
+    return minValue;
+}
+
+// Get the minimum key without removing it
+int IndexedDaryHeap::getMin() {
+    return keys.empty() ? INT_MIN : keys[0];
+}
+
+// Decrease the key of a node
+void IndexedDaryHeap::decreaseKey(PQ_Handle* handle, int newKey) {
+    size_t i = static_cast<DH_Slot*>(handle)->index;
+    if (newKey > keys[i]) {
+        std::cout << "New key is greater than the old key. Cannot decrease.\n";
+        return;
+    }
+
+    keys[i] = newKey;
+    siftUp(i);
+}
+
+// Remove a node wherever it sits
+void IndexedDaryHeap::erase(PQ_Handle* handle) {
+    removeAt(static_cast<DH_Slot*>(handle)->index);
+}
+
+// Decrease the key of a node found by key
+void IndexedDaryHeap::decreaseKey(int oldKey, int newKey) {
+    if (newKey > oldKey) {
+        std::cout << "New key is greater than the old key. Cannot decrease.\n";
+        return;
+    }
+
+    size_t i = findIndex(oldKey);
+    if (i == keys.size()) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    decreaseKey(slots[i], newKey);
+}
+
+// Delete a key from the heap
+void IndexedDaryHeap::deleteKey(int key) {
+    size_t i = findIndex(key);
+    if (i == keys.size()) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    removeAt(i);
+}
+
+// Print the keys in array (level) order
+void IndexedDaryHeap::print() {
+    for (size_t i = 0; i < keys.size(); i++) {
+        std::cout << keys[i] << " ";
+    }
+    std::cout << std::endl;
+}
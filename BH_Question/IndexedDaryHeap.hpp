@@ -0,0 +1,45 @@
+#ifndef INDEXEDDARYHEAP_HPP
+#define INDEXEDDARYHEAP_HPP
+
+#include "PriorityQueue.hpp"
+#include "SlabPool.hpp"
+#include <cstddef>
+#include <vector>
+
+// DaryHeap's 4-ary array with handles, for use as a HandlePriorityQueue.
+// Each key's handle is a pooled slot recording where the key currently
+// sits, kept in a parallel array so comparisons only touch keys. Tracking
+// them costs a slot allocation per insert and an index store per sift
+// step, which makes plain inserts and extracts slower than DaryHeap's; use
+// DaryHeap when no handles are needed.
+class IndexedDaryHeap final : public HandlePriorityQueue {
+private:
+    static const int ARITY = 4;
+
+    struct DH_Slot : PQ_Handle {
+        size_t index;
+    };
+
+    std::vector<int> keys;
+    std::vector<DH_Slot*> slots;   // slots[i] is the handle of keys[i]
+    SlabPool<DH_Slot> pool;
+
+    void place(size_t i, int key, DH_Slot* slot);
+    void siftUp(size_t i);
+    void siftDown(size_t i);
+    void removeAt(size_t i);
+    size_t findIndex(int key);
+
+public:
+    PQ_Handle* insertWithHandle(int key);
+    int extractMin();
+    int getMin();
+    void decreaseKey(PQ_Handle* handle, int newKey);
+    void erase(PQ_Handle* handle);
+    void decreaseKey(int oldKey, int newKey);
+    void deleteKey(int key);
+    bool empty() { return keys.empty(); }
+    void print();
+};
+
+#endif // INDEXEDDARYHEAP_HPP
@@ -0,0 +1,178 @@
+#include "PairingHeap.hpp"
+#include <iostream>
+#include <utility>
+
+using namespace std;
+
+PairingHeap::PairingHeap() : root(nullptr) {}
+
+// A detached node holding key
+PairingHeap::PH_Node* PairingHeap::allocate(int key) {
+    PH_Node* node = pool.allocate();
+    node->key = key;
+    node->child = nullptr;
+    node->sibling = nullptr;
+    node->prev = nullptr;
+    return node;
+}
+
+// Links two detached trees: the larger root becomes the first child of the
+// smaller
+PairingHeap::PH_Node* PairingHeap::meld(PH_Node* a, PH_Node* b) {
+    if (!a) return b;
+    if (!b) return a;
+    if (b->key < a->key) swap(a, b);
+
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child) a->child->prev = b;
+    a->child = b;
+    return a;
+}
+
+// Two-pass pairing of a sibling list into one tree
+PairingHeap::PH_Node* PairingHeap::combineSiblings(PH_Node* first) {
+    if (!first) return nullptr;
+
+    // Left to right: meld each pair of siblings
+    scratch.clear();
+    while (first) {
+        PH_Node* a = first;
+        PH_Node* b = a->sibling;
+        first = b ? b->sibling : nullptr;
+
+        a->sibling = a->prev = nullptr;
+        if (b) b->sibling = b->prev = nullptr;
+        scratch.push_back(meld(a, b));
+    }
+
+    // Right to left: meld the pairs into one tree
+    PH_Node* result = scratch.back();
+    for (size_t i = scratch.size() - 1; i-- > 0;) {
+        result = meld(scratch[i], result);
+    }
+    return result;
+}
+
+// Detach a non-root node, with its subtree, from its parent
+void PairingHeap::cut(PH_Node* node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+    if (node->sibling) node->sibling->prev = node->prev;
+    node->sibling = nullptr;
+    node->prev = nullptr;
+}
+
+// Find a node by key (for Decrease Key and Delete). Iterative, since a
+// pairing heap's trees can be as deep as the heap is large.
+PairingHeap::PH_Node* PairingHeap::findNode(int key) {
+    scratch.clear();
+    if (root) scratch.push_back(root);
+
+    while (!scratch.empty()) {
+        PH_Node* node = scratch.back();
+        scratch.pop_back();
+        if (node->key == key) return node;
+        if (node->sibling) scratch.push_back(node->sibling);
+        if (node->child) scratch.push_back(node->child);
+    }
+    return nullptr;
+}
+
+// Insert a new key into the heap
+PQ_Handle* PairingHeap::insertWithHandle(int key) {
+    PH_Node* node = allocate(key);
+    root = meld(root, node);
+    return node;
+}
+
+// Extract the minimum key from the heap
+int PairingHeap::extractMin() {
+    if (!root) return INT_MIN;
+
+    PH_Node* minNode = root;
+    root = combineSiblings(minNode->child);
+
+    int minValue = minNode->key;
+    pool.release(minNode);
+    return minValue;
+}
+
+// Get the minimum key without removing it
+int PairingHeap::getMin() {
+    return root ? root->key : INT_MIN;
+}
+
+// Decrease the key of a node: cut its subtree out and meld it with the root
+void PairingHeap::decreaseKey(PQ_Handle* handle, int newKey) {
+    PH_Node* node = static_cast<PH_Node*>(handle);
+    if (newKey > node->key) {
+        std::cout << "New key is greater than the old key. Cannot decrease.\n";
+        return;
+    }
+
+    node->key = newKey;
+    if (node != root) {
+        cut(node);
+        root = meld(root, node);
+    }
+}
+
+// Remove a node: its children are paired up into one tree and melded back
+// in
+void PairingHeap::erase(PQ_Handle* handle) {
+    PH_Node* node = static_cast<PH_Node*>(handle);
+    if (node == root) {
+        extractMin();
+        return;
+    }
+
+    cut(node);
+    root = meld(root, combineSiblings(node->child));
+    pool.release(node);
+}
+
+// Decrease the key of a node found by key
+void PairingHeap::decreaseKey(int oldKey, int newKey) {
+    if (newKey > oldKey) {
+        std::cout << "New key is greater than the old key. Cannot decrease.\n";
+        return;
+    }
+
+    PH_Node* node = findNode(oldKey);
+    if (!node) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    decreaseKey(node, newKey);
+}
+
+// Delete a key from the heap
+void PairingHeap::deleteKey(int key) {
+    PH_Node* node = findNode(key);
+    if (!node) {
+        std::cout << "Key not found!\n";
+        return;
+    }
+
+    erase(node);
+}
+
+// Print the keys in preorder
+void PairingHeap::print() {
+    scratch.clear();
+    if (root) scratch.push_back(root);
+
+    while (!scratch.empty()) {
+        PH_Node* node = scratch.back();
+        scratch.pop_back();
+        std::cout << node->key << " ";
+        if (node->sibling) scratch.push_back(node->sibling);
+        if (node->child) scratch.push_back(node->child);
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,49 @@
+#ifndef PAIRINGHEAP_HPP
+#define PAIRINGHEAP_HPP
+
+#include "PriorityQueue.hpp"
+#include "SlabPool.hpp"
+#include <vector>
+
+// Pairing heap: one heap-ordered tree whose children are kept in a sibling
+// list. insert and decreaseKey are a single link against the root;
+// extractMin pairs up the root's children left to right, then melds the
+// pairs right to left. Nodes come from a SlabPool owned by the heap, so a
+// steady insert/extract mix allocates nothing. A node is its key's handle.
+class PairingHeap final : public HandlePriorityQueue {
+private:
+    struct PH_Node : PQ_Handle {
+        int key;
+        PH_Node* child;     // first child
+        PH_Node* sibling;   // next sibling
+        PH_Node* prev;      // previous sibling, or the parent of a first child
+    };
+
+    PH_Node* root;
+    SlabPool<PH_Node> pool;
+    std::vector<PH_Node*> scratch;   // pairs in extractMin, the stack in findNode
+
+    PairingHeap(const PairingHeap&);
+    PairingHeap& operator=(const PairingHeap&);
+
+    PH_Node* allocate(int key);
+    PH_Node* meld(PH_Node* a, PH_Node* b);
+    PH_Node* combineSiblings(PH_Node* first);
+    void cut(PH_Node* node);
+    PH_Node* findNode(int key);
+
+public:
+    PairingHeap();
+
+    PQ_Handle* insertWithHandle(int key);
+    int extractMin();
+    int getMin();
+    void decreaseKey(PQ_Handle* handle, int newKey);
+    void erase(PQ_Handle* handle);
+    void decreaseKey(int oldKey, int newKey);
+    void deleteKey(int key);
+    bool empty() { return root == nullptr; }
+    void print();
+};
+
+#endif // PAIRINGHEAP_HPP
@@ -0,0 +1,40 @@
+#ifndef PRIORITYQUEUE_HPP
+#define PRIORITYQUEUE_HPP
+
+#include <climits>
+
+// Min-priority queue of ints, implemented by each heap engine so callers
+// and benchmarks can switch between them. Duplicate keys are allowed.
+// getMin and extractMin return INT_MIN when the queue is empty; decreaseKey
+// and deleteKey act on any one node holding the given key.
+class PriorityQueue {
+public:
+    virtual ~PriorityQueue() {}
+
+    virtual void insert(int key) = 0;
+    virtual int extractMin() = 0;
+    virtual int getMin() = 0;
+    virtual void decreaseKey(int oldKey, int newKey) = 0;
+    virtual void deleteKey(int key) = 0;
+    virtual bool empty() = 0;
+    virtual void print() = 0;
+};
+
+// A key inside a HandlePriorityQueue, as returned by insertWithHandle. It
+// stays valid, and keeps referring to the same key, until that key is
+// extracted or erased. Each engine's node type derives from it.
+struct PQ_Handle {};
+
+// A PriorityQueue whose keys can also be reached through their handles, so
+// decreaseKey and erase go straight to the node instead of searching
+class HandlePriorityQueue : public PriorityQueue {
+public:
+    using PriorityQueue::decreaseKey;
+
+    void insert(int key) { insertWithHandle(key); }
+    virtual PQ_Handle* insertWithHandle(int key) = 0;
+    virtual void decreaseKey(PQ_Handle* handle, int newKey) = 0;
+    virtual void erase(PQ_Handle* handle) = 0;
+};
+
+#endif // PRIORITYQUEUE_HPP
@@ -0,0 +1,48 @@
+#ifndef SLABPOOL_HPP
+#define SLABPOOL_HPP
+
+#include <cstddef>
+#include <vector>
+
+// Fixed-size node allocator for the heap engines. Nodes are carved out of
+// slabs of SLAB_NODES, handed out in address order, and a released node is
+// reused by the next allocation. Everything is freed with the pool.
+template <typename T>
+class SlabPool {
+private:
+    static const size_t SLAB_NODES = 1024;
+
+    std::vector<T*> slabs;
+    std::vector<T*> freeNodes;   // next to hand out at the back
+
+    SlabPool(const SlabPool&);
+    SlabPool& operator=(const SlabPool&);
+
+public:
+    SlabPool() {}
+
+    ~SlabPool() {
+        for (size_t i = 0; i < slabs.size(); i++) {
+            delete[] slabs[i];
+        }
+    }
+
+    T* allocate() {
+        if (freeNodes.empty()) {
+            T* slab = new T[SLAB_NODES];
+            slabs.push_back(slab);
+            for (size_t i = SLAB_NODES; i-- > 0;) {
+                freeNodes.push_back(&slab[i]);
+            }
+        }
+        T* node = freeNodes.back();
+        freeNodes.pop_back();
+        return node;
+    }
+
+    void release(T* node) {
+        freeNodes.push_back(node);
+    }
+};
+
+#endif // SLABPOOL_HPP
@@ -0,0 +1,214 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include "BinomialHeap.hpp"
+#include "DaryHeap.hpp"
+#include "IndexedDaryHeap.hpp"
+#include "PairingHeap.hpp"
+
+// Usage: heap_bench [ops]
+// Times each engine on six workloads and prints CSV of ns per operation:
+//   sort      insert ops random keys, then extract them all
+//   drain     the same, but checking getMin before every extractMin, as
+//             main's drain loop does
+//   peek      ops getMins against a tenth as many keys
+//   steady    ops random inserts and extractMins against a tenth as many keys
+//   by-key    insert a few thousand keys, decrease a quarter and erase
+//             another quarter with decreaseKey and deleteKey, which find
+//             their key by search, then extract the rest
+//   handles   the same on ops keys, but through their handles
+//             (HandlePriorityQueue engines only)
+// Each workload's extracted keys are summed so the engines can be checked
+// against each other.
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* workload, const char* engine, double ns, size_t ops, uint64_t sum) {
+    std::cout << workload << "," << engine << "," << ns / ops << "," << sum << std::endl;
+}
+
+template <typename Heap>
+static void sortWorkload(const char* engine, const std::vector<int>& keys) {
+    Heap heap;
+    uint64_t sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < keys.size(); i++) {
+        heap.insert(keys[i]);
+    }
+    while (!heap.empty()) {
+        sum = sum * 31 + heap.extractMin();
+    }
+    report("sort", engine, elapsedNs(start), 2 * keys.size(), sum);
+}
+
+template <typename Heap>
+static void drainWorkload(const char* engine, const std::vector<int>& keys) {
+    Heap heap;
+    uint64_t sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < keys.size(); i++) {
+        heap.insert(keys[i]);
+    }
+    while (heap.getMin() != INT_MIN) {
+        sum = sum * 31 + heap.extractMin();
+    }
+    report("drain", engine, elapsedNs(start), 2 * keys.size(), sum);
+}
+
+template <typename Heap>
+static void peekWorkload(const char* engine, const std::vector<int>& keys) {
+    Heap heap;
+    size_t prefill = keys.size() / 10;
+    for (size_t i = 0; i < prefill; i++) {
+        heap.insert(keys[i]);
+    }
+
+    uint64_t sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < keys.size(); i++) {
+        sum = sum * 31 + heap.getMin();
+    }
+    report("peek", engine, elapsedNs(start), keys.size(), sum);
+
+    while (!heap.empty()) {
+        heap.extractMin();
+    }
+}
+
+template <typename Heap>
+static void steadyWorkload(const char* engine, const std::vector<int>& keys) {
+    Heap heap;
+    size_t prefill = keys.size() / 10;
+    for (size_t i = 0; i < prefill; i++) {
+        heap.insert(keys[i]);
+    }
+
+    // Key parity picks the operation, so every engine sees the same mix
+    uint64_t sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < keys.size(); i++) {
+        if ((keys[i] & 1) == 0 || heap.empty()) {
+            heap.insert(keys[i]);
+        } else {
+            sum = sum * 31 + heap.extractMin();
+        }
+    }
+    report("steady", engine, elapsedNs(start), keys.size(), sum);
+
+    while (!heap.empty()) {
+        heap.extractMin();
+    }
+}
+
+// A shuffled order over the first count keys: the first quarter of it is
+// decreased and the second erased
+static std::vector<size_t> shuffledOrder(size_t count, std::mt19937& rng) {
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), rng);
+    return order;
+}
+
+// Decreases a quarter of the keys and erases another quarter through their
+// handles, then extracts the rest
+template <typename Heap>
+static void handlesWorkload(const char* engine, const std::vector<int>& keys) {
+    Heap heap;
+    size_t count = keys.size();
+    std::vector<int> present(keys);
+    std::vector<PQ_Handle*> handles(count);
+    std::mt19937 rng(7);
+    std::vector<size_t> order = shuffledOrder(count, rng);
+    size_t quarter = count / 4;
+    uint64_t sum = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++) {
+        handles[i] = heap.insertWithHandle(present[i]);
+    }
+    for (size_t i = 0; i < quarter; i++) {
+        size_t j = order[i];
+        int newKey = present[j] - static_cast<int>(rng() % 1000);
+        heap.decreaseKey(handles[j], newKey);
+        present[j] = newKey;
+    }
+    for (size_t i = quarter; i < 2 * quarter; i++) {
+        heap.erase(handles[order[i]]);
+    }
+    while (!heap.empty()) {
+        sum = sum * 31 + heap.extractMin();
+    }
+    report("handles", engine, elapsedNs(start), 2 * count + quarter, sum);
+}
+
+// The same on the first count keys, but decreaseKey and deleteKey find
+// their key by search
+template <typename Heap>
+static void byKeyWorkload(const char* engine, const std::vector<int>& keys, size_t count) {
+    Heap heap;
+    std::vector<int> present(keys.begin(), keys.begin() + count);
+    std::mt19937 rng(7);
+    std::vector<size_t> order = shuffledOrder(count, rng);
+    size_t quarter = count / 4;
+    uint64_t sum = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++) {
+        heap.insert(present[i]);
+    }
+    for (size_t i = 0; i < quarter; i++) {
+        size_t j = order[i];
+        int newKey = present[j] - static_cast<int>(rng() % 1000);
+        heap.decreaseKey(present[j], newKey);
+        present[j] = newKey;
+    }
+    for (size_t i = quarter; i < 2 * quarter; i++) {
+        heap.deleteKey(present[order[i]]);
+    }
+    while (!heap.empty()) {
+        sum = sum * 31 + heap.extractMin();
+    }
+    report("by-key", engine, elapsedNs(start), 2 * count + quarter, sum);
+}
+
+template <typename Heap>
+static void runAll(const char* engine, const std::vector<int>& keys, size_t decreaseCount) {
+    sortWorkload<Heap>(engine, keys);
+    drainWorkload<Heap>(engine, keys);
+    peekWorkload<Heap>(engine, keys);
+    steadyWorkload<Heap>(engine, keys);
+    byKeyWorkload<Heap>(engine, keys, decreaseCount);
+}
+
+// Only HandlePriorityQueue engines run the handles workload
+template <typename Heap>
+static void runAllWithHandles(const char* engine, const std::vector<int>& keys, size_t decreaseCount) {
+    runAll<Heap>(engine, keys, decreaseCount);
+    handlesWorkload<Heap>(engine, keys);
+}
+
+int main(int argc, char* argv[]) {
+    size_t ops = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::mt19937 rng(42);
+    std::vector<int> keys(ops);
+    for (size_t i = 0; i < ops; i++) {
+        keys[i] = static_cast<int>(rng() % 1000000000);
+    }
+    size_t decreaseCount = ops < 8000 ? ops : 8000;
+
+    std::cout << "workload,engine,ns_per_op,checksum" << std::endl;
+    runAllWithHandles<BinomialHeap>("binomial", keys, decreaseCount);
+    runAll<DaryHeap>("4-ary", keys, decreaseCount);
+    runAllWithHandles<IndexedDaryHeap>("4-ary-indexed", keys, decreaseCount);
+    runAllWithHandles<PairingHeap>("pairing", keys, decreaseCount);
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <vector>
+#include <set>
+#include <random>
+#include <cstdlib>
+#include "BinomialHeap.hpp"
+#include "DaryHeap.hpp"
+#include "IndexedDaryHeap.hpp"
+#include "PairingHeap.hpp"
+
+// Usage: heap_test [rounds]
+// Checks every heap engine against a std::multiset oracle. Each round runs
+// a random mix of insert, extractMin and the key-based decreaseKey and
+// deleteKey (absent keys included) on a small key range, so duplicate keys
+// are common. The handle engines also insert with handles and decrease and
+// erase through them, which moves nodes past equal and larger keys, and
+// BinomialHeap also takes in other heaps with unionHeaps, whose handles
+// stay valid. After every step getMin and empty are compared with the
+// oracle, and each round ends by draining the heap in order. Exits
+// non-zero at the first mismatch.
+
+static int failures = 0;
+
+static bool fail(const char* engine, int round, int step, const char* what) {
+    std::cerr << engine << ", round " << round << ", step " << step << ": " << what << std::endl;
+    failures++;
+    return false;
+}
+
+// A handle whose key is known. Once an operation may have removed or
+// changed an unknown node holding some key, handles to that key are
+// dropped, since the test can no longer tell which of them is still valid.
+struct Tracked {
+    PQ_Handle* handle;
+    int key;
+};
+
+static void forget(std::vector<Tracked>& tracked, int key) {
+    for (size_t i = 0; i < tracked.size();) {
+        if (tracked[i].key == key) {
+            tracked[i] = tracked.back();
+            tracked.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+static int anyKey(const std::multiset<int>& oracle, std::mt19937& rng) {
+    std::multiset<int>::const_iterator it = oracle.begin();
+    std::advance(it, rng() % oracle.size());
+    return *it;
+}
+
+static bool check(const char* engine, PriorityQueue& heap, const std::multiset<int>& oracle, int round, int step) {
+    int expected = oracle.empty() ? INT_MIN : *oracle.begin();
+    if (heap.getMin() != expected) return fail(engine, round, step, "getMin differs");
+    if (heap.empty() != oracle.empty()) return fail(engine, round, step, "empty differs");
+    return true;
+}
+
+static bool drain(const char* engine, PriorityQueue& heap, std::multiset<int>& oracle, int round, int step) {
+    while (!oracle.empty()) {
+        if (heap.extractMin() != *oracle.begin()) return fail(engine, round, step, "extractMin differs");
+        oracle.erase(oracle.begin());
+    }
+    if (!heap.empty() || heap.extractMin() != INT_MIN) return fail(engine, round, step, "heap not empty");
+    return true;
+}
+
+// One round on heap. handles is the same heap when it is a
+// HandlePriorityQueue and null otherwise; binomial likewise.
+static void fuzz(const char* engine, PriorityQueue& heap, HandlePriorityQueue* handles, BinomialHeap* binomial,
+                 int round) {
+    std::mt19937 rng(round);
+    std::multiset<int> oracle;
+    std::vector<Tracked> tracked;
+    int keyRange = 20 + rng() % 200;
+
+    for (int step = 0; step < 400 && failures == 0; step++) {
+        int op = rng() % 100;
+        int key = rng() % keyRange;
+
+        if (op < 30) {
+            if (handles) {
+                Tracked t = {handles->insertWithHandle(key), key};
+                tracked.push_back(t);
+            } else {
+                heap.insert(key);
+            }
+            oracle.insert(key);
+        } else if (op < 45) {
+            int expected = oracle.empty() ? INT_MIN : *oracle.begin();
+            if (heap.extractMin() != expected) {
+                fail(engine, round, step, "extractMin differs");
+                break;
+            }
+            if (!oracle.empty()) {
+                oracle.erase(oracle.begin());
+                forget(tracked, expected);
+            }
+        } else if (op < 55 && handles && !tracked.empty()) {
+            // Down to an equal key as well, which must not move the node
+            size_t i = rng() % tracked.size();
+            int newKey = tracked[i].key - static_cast<int>(rng() % 30);
+            handles->decreaseKey(tracked[i].handle, newKey);
+            oracle.erase(oracle.find(tracked[i].key));
+            oracle.insert(newKey);
+            tracked[i].key = newKey;
+        } else if (op < 65 && handles && !tracked.empty()) {
+            size_t i = rng() % tracked.size();
+            handles->erase(tracked[i].handle);
+            oracle.erase(oracle.find(tracked[i].key));
+            tracked[i] = tracked.back();
+            tracked.pop_back();
+        } else if (op < 75 && !oracle.empty()) {
+            int oldKey = anyKey(oracle, rng);
+            int newKey = oldKey - static_cast<int>(rng() % 30);
+            heap.decreaseKey(oldKey, newKey);
+            oracle.erase(oracle.find(oldKey));
+            oracle.insert(newKey);
+            forget(tracked, oldKey);
+        } else if (op < 85 && !oracle.empty()) {
+            int victim = anyKey(oracle, rng);
+            heap.deleteKey(victim);
+            oracle.erase(oracle.find(victim));
+            forget(tracked, victim);
+        } else if (op < 90) {
+            // An absent key reports itself on stdout and changes nothing
+            std::streambuf* out = std::cout.rdbuf(nullptr);
+            heap.deleteKey(keyRange + 1);
+            heap.decreaseKey(keyRange + 1, 0);
+            std::cout.rdbuf(out);
+        } else if (op < 97 && binomial) {
+            BinomialHeap other;
+            int count = rng() % 8;
+            for (int j = 0; j < count; j++) {
+                int otherKey = rng() % keyRange;
+                Tracked t = {other.insertWithHandle(otherKey), otherKey};
+                tracked.push_back(t);
+                oracle.insert(otherKey);
+            }
+            binomial->unionHeaps(other);
+            if (!other.empty() || other.getMin() != INT_MIN) fail(engine, round, step, "union left the other heap");
+        } else if (op >= 99) {
+            drain(engine, heap, oracle, round, step);
+            tracked.clear();
+        }
+
+        check(engine, heap, oracle, round, step);
+    }
+
+    if (failures == 0) drain(engine, heap, oracle, round, 400);
+}
+
+int main(int argc, char* argv[]) {
+    int rounds = argc > 1 ? atoi(argv[1]) : 200;
+
+    for (int round = 0; round < rounds && failures == 0; round++) {
+        BinomialHeap binomial;
+        fuzz("binomial", binomial, &binomial, &binomial, round);
+
+        DaryHeap dary;
+        fuzz("4-ary", dary, nullptr, nullptr, round);
+
+        IndexedDaryHeap indexed;
+        fuzz("4-ary-indexed", indexed, &indexed, nullptr, round);
+
+        PairingHeap pairing;
+        fuzz("pairing", pairing, &pairing, nullptr, round);
+    }
+
+    if (failures != 0) return 1;
+    std::cout << "heap_test: " << rounds << " rounds passed" << std::endl;
+    return 0;
+}
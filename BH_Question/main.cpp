@@ -49,6 +49,15 @@ int main() {
     std::cout << "Heap after more insertions: ";
     bh.print();
 
+    // insertWithHandle returns a handle to the new key's node
+    BH_Node* handle = bh.insertWithHandle(40);
+    std::cout << "Decreasing the key inserted as 40 to 1 through its handle" << std::endl;
+    bh.decreaseKey(handle, 1);
+    bh.print();
+    std::cout << "Erasing it through its handle" << std::endl;
+    bh.erase(handle);
+    bh.print();
+
     //Union Demo--create a new Heap and then merge them:
 
     BinomialHeap bh2;
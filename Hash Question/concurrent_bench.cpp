@@ -0,0 +1,81 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "concurrent_hash_table.hpp"
+#include "hash_table.hpp"
+#include "zipf.hpp"
+
+using namespace std;
+
+static const size_t VOCABULARY = 100000;
+static const size_t OPS_PER_THREAD = 2000000;
+
+// The single-lock baseline: the plain table behind one mutex
+struct LockedHashTable {
+    HashTable table;
+    mutex lock;
+
+    LockedHashTable() : table(MAXHASH) {}
+    void insert(string_view word) {
+        lock_guard<mutex> guard(lock);
+        table.insert(word);
+    }
+};
+
+// Run every thread's stream of word ranks against table; return ops/sec
+template <typename Table>
+double run(Table& table, const vector<string>& words, const vector<vector<uint32_t> >& streams,
+           unsigned threads) {
+    vector<thread> workers;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (unsigned t = 0; t < threads; t++) {
+        workers.push_back(thread([&table, &words, &streams, t]() {
+            const vector<uint32_t>& stream = streams[t];
+            for (size_t i = 0; i < stream.size(); i++) {
+                table.insert(words[stream[i]]);
+            }
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return threads * OPS_PER_THREAD / seconds;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned max_threads = argc > 1 ? atoi(argv[1]) : thread::hardware_concurrency();
+    double skew = argc > 2 ? atof(argv[2]) : 1.0;
+    if (max_threads == 0) max_threads = 1;
+
+    vector<string> words(VOCABULARY);
+    for (size_t i = 0; i < VOCABULARY; i++) {
+        words[i] = synthetic_word(i);
+    }
+
+    // Sample every thread's words up front so the timed loop is only table work
+    vector<vector<uint32_t> > streams(max_threads, vector<uint32_t>(OPS_PER_THREAD));
+    for (unsigned t = 0; t < max_threads; t++) {
+        ZipfGenerator zipf(VOCABULARY, skew, 1000 + t);
+        for (size_t i = 0; i < OPS_PER_THREAD; i++) {
+            streams[t][i] = zipf.next();
+        }
+    }
+
+    cout << "threads,lock_free_ops_per_sec,mutex_ops_per_sec\n";
+    for (unsigned threads = 1; threads <= max_threads; threads++) {
+        ConcurrentHashTable lock_free(VOCABULARY);
+        LockedHashTable locked;
+        double a = run(lock_free, words, streams, threads);
+        double b = run(locked, words, streams, threads);
+        cout << threads << "," << a << "," << b << "\n";
+    }
+    return 0;
+}
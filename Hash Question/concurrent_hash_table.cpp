@@ -0,0 +1,171 @@
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "concurrent_hash_table.hpp"
+#include "hash_functions.hpp"
+
+using namespace std;
+
+static uint64_t hash_word(string_view word) {
+    return WyHash::hash(word.data(), word.size());
+}
+
+ConcurrentHashTable::ConcurrentHashTable(size_t max_words) : capacity(16), overflowed(false) {
+    // Linear probing stays short while the table is at most half full
+    while (capacity < 2 * max_words) {
+        capacity *= 2;
+    }
+    slots = new Slot[capacity];
+    for (size_t i = 0; i < capacity; i++) {
+        slots[i].key.store(nullptr, memory_order_relaxed);
+        slots[i].count.store(DELETED, memory_order_relaxed);
+    }
+}
+
+ConcurrentHashTable::~ConcurrentHashTable() {
+    for (size_t i = 0; i < capacity; i++) {
+        free(slots[i].key.load(memory_order_relaxed));
+    }
+    delete[] slots;
+}
+
+// Return the slot claimed by word, or -1 if no slot has it
+long ConcurrentHashTable::find_slot(string_view word, uint64_t h) {
+    size_t mask = capacity - 1;
+    for (size_t i = 0, slot = h & mask; i < capacity; i++, slot = (slot + 1) & mask) {
+        ConcurrentKey* key = slots[slot].key.load(memory_order_acquire);
+        if (key == nullptr) return -1;
+        if (key->hash == h && key->word() == word) return static_cast<long>(slot);
+    }
+    return -1;
+}
+
+bool ConcurrentHashTable::insert(string_view word) {
+    return add(word, 1);
+}
+
+// Add count occurrences of word, claiming a slot for it if it has none.
+// Returns false, leaving the table unchanged, if the word is new and the
+// table is full.
+bool ConcurrentHashTable::add(string_view word, int count) {
+    uint64_t h = hash_word(word);
+    size_t mask = capacity - 1;
+    ConcurrentKey* mine = nullptr;  // allocated on the first empty slot we try to claim
+
+    for (size_t i = 0, slot = h & mask; i < capacity; i++, slot = (slot + 1) & mask) {
+        ConcurrentKey* key = slots[slot].key.load(memory_order_acquire);
+
+        if (key == nullptr) {
+            if (mine == nullptr) {
+                mine = static_cast<ConcurrentKey*>(malloc(sizeof(ConcurrentKey) + word.size()));
+                mine->hash = h;
+                mine->length = word.size();
+                memcpy(mine->data, word.data(), word.size());
+            }
+            // On failure key receives the word another thread put here
+            if (slots[slot].key.compare_exchange_strong(key, mine, memory_order_acq_rel)) {
+                key = mine;
+                mine = nullptr;
+            }
+        }
+
+        if (key->hash == h && key->word() == word) {
+            // Add to a live word with one fetch_add, so hot words never
+            // retry. If the word was deleted the add left the count
+            // negative; reset it to count, unless another thread revived it
+            // first, in which case add to that.
+            atomic<int>& c = slots[slot].count;
+            if (c.fetch_add(count, memory_order_relaxed) < 0) {
+                int current = c.load(memory_order_relaxed);
+                while (true) {
+                    if (current >= 0) {
+                        c.fetch_add(count, memory_order_relaxed);
+                        break;
+                    }
+                    if (c.compare_exchange_weak(current, count, memory_order_relaxed)) break;
+                }
+            }
+            free(mine);
+            return true;
+        }
+    }
+
+    free(mine);
+    if (!overflowed.exchange(true)) {
+        cerr << "ConcurrentHashTable is full; new words past its capacity are rejected" << endl;
+    }
+    return false;
+}
+
+// Find a word and return its count, or -1 if not found
+int ConcurrentHashTable::find(string_view word) {
+    long slot = find_slot(word, hash_word(word));
+    int count = slot >= 0 ? slots[slot].count.load(memory_order_relaxed) : DELETED;
+
+    if (count >= 0) {
+        cout << word << " frequency: " << count << endl;
+        return count;
+    }
+    cout << "Key Not Found \nKey count reset to: ";
+    return -1;  // Word not found
+}
+
+// Delete a word from the hash table; its slot stays reserved for it
+void ConcurrentHashTable::deleteWord(string_view word) {
+    long slot = find_slot(word, hash_word(word));
+    if (slot >= 0) {
+        slots[slot].count.store(DELETED, memory_order_relaxed);
+    }
+}
+
+// Increase the count of a word, inserting it if needed
+bool ConcurrentHashTable::increase(string_view word) {
+    return add(word, 1);
+}
+
+// Print all words and their counts. Concurrent updates may or may not be
+// reflected in the output.
+void ConcurrentHashTable::list_all_keys(ofstream& output_file) {
+    for (size_t i = 0; i < capacity; i++) {
+        ConcurrentKey* key = slots[i].key.load(memory_order_acquire);
+        int count = slots[i].count.load(memory_order_relaxed);
+        if (key == nullptr || count < 0) continue;
+        output_file << key->word() << ": " << count << "\n";
+    }
+}
+
+// Probe length statistics: a word collides when it sits past its home slot
+void ConcurrentHashTable::collision_statistics() {
+    vector<int> histogram;
+    size_t words = 0;
+    int total_collisions = 0;
+    size_t max_length = 0;
+    double total_length = 0;
+
+    for (size_t i = 0; i < capacity; i++) {
+        ConcurrentKey* key = slots[i].key.load(memory_order_acquire);
+        if (key == nullptr) continue;
+
+        size_t length = ((i - key->hash) & (capacity - 1)) + 1;
+        if (length >= histogram.size()) histogram.resize(length + 1, 0);
+        histogram[length]++;
+        words++;
+        total_length += length;
+        if (length > 1) total_collisions++;
+        if (length > max_length) max_length = length;
+    }
+
+    cout << "Table capacity: " << capacity << " slots, " << words << " claimed" << endl;
+    cout << "Total collisions: " << total_collisions << endl;
+    cout << "Max probe length (slots): " << max_length << endl;
+    cout << "Mean probe length: " << (words ? total_length / words : 0) << endl;
+
+    cout << "\nHistogram of Probe Lengths:\n";
+    for (size_t i = 1; i < histogram.size(); i++) {
+        if (histogram[i] > 0) {
+            cout << "Length " << i << ": " << histogram[i] << " words\n";
+        }
+    }
+}
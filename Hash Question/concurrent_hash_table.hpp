@@ -0,0 +1,66 @@
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+// Key bytes, allocated once when a word first claims a slot and never moved
+struct ConcurrentKey {
+    uint64_t hash;
+    size_t length;
+    char data[1];
+
+    string_view word() const { return string_view(data, length); }
+};
+
+// Lock-free counting table for many threads calling insert/increase on the
+// same words. Slots are claimed with a compare-and-swap on their key pointer
+// and counts are updated with atomic read-modify-writes, so no operation
+// ever blocks another.
+//
+// A slot keeps its key once claimed: deleteWord only marks the count as
+// deleted, and a later insert of the same word revives it in place. The
+// capacity is therefore fixed at construction and must cover every distinct
+// word the table will see; insert, add and increase return false for a new
+// word once every slot is claimed.
+class ConcurrentHashTable {
+    public:
+        ConcurrentHashTable(size_t max_words);
+        ~ConcurrentHashTable();
+
+        bool insert(string_view word);
+        bool add(string_view word, int count);
+
+        int find(string_view word);
+        void deleteWord(string_view word);
+        bool increase(string_view word);
+        void list_all_keys(ofstream& output_file);
+        void collision_statistics();
+    private:
+        // Count of a claimed slot whose word is not present. Any negative
+        // count means deleted, so increments racing with deleteWord cannot
+        // bring a word back by accident.
+        static const int DELETED = INT_MIN;
+
+        struct Slot {
+            atomic<ConcurrentKey*> key;
+            atomic<int> count;
+        };
+
+        size_t capacity;    // power of two, at least twice max_words
+        Slot* slots;
+        atomic<bool> overflowed;
+
+        long find_slot(string_view word, uint64_t h);
+
+        ConcurrentHashTable(const ConcurrentHashTable&);
+        ConcurrentHashTable& operator=(const ConcurrentHashTable&);
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "hash_table.hpp"
+#include "tokenizer.hpp"
+
+using namespace std;
+
+// Read and clean the corpus the same way main.cpp does
+static vector<string> read_words(const char* path) {
+    MappedFile input_file(path);
+    Tokenizer tokenizer(input_file.data(), input_file.size());
+    vector<string> words;
+    string_view word;
+
+    while (tokenizer.next(word)) {
+        words.push_back(string(word));
+    }
+    return words;
+}
+
+static double elapsed_ns(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+// Time the hash on its own, then a full table build, then print the
+// table's collision statistics
+template <typename Hasher>
+void run(const vector<string>& words) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < words.size(); i++) {
+        checksum += Hasher::hash(words[i].data(), words[i].size());
+    }
+    double hash_ns = elapsed_ns(start) / words.size();
+
+    start = chrono::steady_clock::now();
+    BasicHashTable<Hasher> ht(MAXHASH);
+    for (size_t i = 0; i < words.size(); i++) {
+        ht.insert(words[i]);
+    }
+    double insert_ns = elapsed_ns(start) / words.size();
+
+    cout << "== " << Hasher::name() << " (checksum " << hex << checksum << dec << ") ==\n";
+    cout << "hash: " << hash_ns << " ns/word, insert: " << insert_ns << " ns/word\n";
+    ht.collision_statistics();
+    cout << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    const char* path = argc > 1 ? argv[1] : "alice_in_wonderland.txt";
+    vector<string> words = read_words(path);
+
+    if (words.empty()) {
+        cerr << "Could not read any words from " << path << endl;
+        return 1;
+    }
+    cout << words.size() << " words from " << path << "\n\n";
+
+    run<PolynomialHash>(words);
+    run<FNV1a>(words);
+    run<WyHash>(words);
+    run<XXHash64>(words);
+#ifdef HASH_HAVE_CRC32
+    run<CRC32Hash>(words);
+#else
+    cout << "crc32c: not available (build with BENCHFLAGS=\"-O2 -msse4.2\")\n";
+#endif
+
+    return 0;
+}
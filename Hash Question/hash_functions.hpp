@@ -0,0 +1,223 @@
+#ifndef HASH_FUNCTIONS_H
+#define HASH_FUNCTIONS_H
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define HASH_HAVE_CRC32 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define HASH_HAVE_CRC32 1
+#endif
+
+// Hash policies for BasicHashTable. Each one hashes a whole word to a full
+// 64-bit value in one call; the table takes the group index from the high
+// bits and the control tag from the low 7 bits, so both must be well mixed.
+
+static inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// The original polynomial hash (multiplier 521, case-folded), with a 64-bit
+// finalizer in place of the per-character modulo
+struct PolynomialHash {
+    static const char* name() { return "polynomial"; }
+
+    static uint64_t hash(const char* data, size_t len) {
+        uint64_t hash_value = 0;
+        for (size_t i = 0; i < len; i++) {
+            hash_value = hash_value * 521 + tolower(static_cast<unsigned char>(data[i]));
+        }
+        hash_value ^= hash_value >> 33;
+        hash_value *= 0xff51afd7ed558ccdULL;
+        hash_value ^= hash_value >> 33;
+        hash_value *= 0xc4ceb9fe1a85ec53ULL;
+        hash_value ^= hash_value >> 33;
+        return hash_value;
+    }
+};
+
+// 64-bit FNV-1a: one xor and one multiply per byte
+struct FNV1a {
+    static const char* name() { return "fnv1a"; }
+
+    static uint64_t hash(const char* data, size_t len) {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (size_t i = 0; i < len; i++) {
+            h ^= static_cast<unsigned char>(data[i]);
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+};
+
+// wyhash (final version 4): words of up to 16 bytes are read with at most
+// four overlapping loads and finished with two 64x64->128 multiplies
+struct WyHash {
+    static const char* name() { return "wyhash"; }
+
+    static void mum(uint64_t* a, uint64_t* b) {
+        __uint128_t r = static_cast<__uint128_t>(*a) * *b;
+        *a = static_cast<uint64_t>(r);
+        *b = static_cast<uint64_t>(r >> 64);
+    }
+
+    static uint64_t mix(uint64_t a, uint64_t b) {
+        mum(&a, &b);
+        return a ^ b;
+    }
+
+    static uint64_t hash(const char* data, size_t len) {
+        static const uint64_t secret[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                                           0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+        uint64_t seed = mix(secret[0], secret[1]);
+        uint64_t a, b;
+
+        if (len <= 16) {
+            if (len >= 4) {
+                size_t mid = (len >> 3) << 2;
+                a = (static_cast<uint64_t>(read32(p)) << 32) | read32(p + mid);
+                b = (static_cast<uint64_t>(read32(p + len - 4)) << 32) | read32(p + len - 4 - mid);
+            } else if (len > 0) {
+                a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t i = len;
+            if (i > 48) {
+                uint64_t see1 = seed, see2 = seed;
+                do {
+                    seed = mix(read64(p) ^ secret[1], read64(p + 8) ^ seed);
+                    see1 = mix(read64(p + 16) ^ secret[2], read64(p + 24) ^ see1);
+                    see2 = mix(read64(p + 32) ^ secret[3], read64(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16) {
+                seed = mix(read64(p) ^ secret[1], read64(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = read64(p + i - 16);
+            b = read64(p + i - 8);
+        }
+        a ^= secret[1];
+        b ^= seed;
+        mum(&a, &b);
+        return mix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+};
+
+// XXH64, processing 8 bytes per step once the input is past 32 bytes
+struct XXHash64 {
+    static const char* name() { return "xxh64"; }
+
+    static const uint64_t P1 = 11400714785074694791ULL;
+    static const uint64_t P2 = 14029467366897019727ULL;
+    static const uint64_t P3 = 1609587929392839161ULL;
+    static const uint64_t P4 = 9650029242287828579ULL;
+    static const uint64_t P5 = 2870177450012600261ULL;
+
+    static uint64_t round(uint64_t acc, uint64_t input) {
+        acc += input * P2;
+        acc = rotl64(acc, 31);
+        return acc * P1;
+    }
+
+    static uint64_t merge(uint64_t acc, uint64_t val) {
+        acc ^= round(0, val);
+        return acc * P1 + P4;
+    }
+
+    static uint64_t hash(const char* data, size_t len) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+        const unsigned char* end = p + len;
+        uint64_t h;
+
+        if (len >= 32) {
+            uint64_t v1 = P1 + P2, v2 = P2, v3 = 0, v4 = 0 - P1;
+            do {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+                p += 32;
+            } while (p + 32 <= end);
+            h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+            h = merge(h, v1);
+            h = merge(h, v2);
+            h = merge(h, v3);
+            h = merge(h, v4);
+        } else {
+            h = P5;
+        }
+        h += len;
+
+        for (; p + 8 <= end; p += 8) {
+            h ^= round(0, read64(p));
+            h = rotl64(h, 27) * P1 + P4;
+        }
+        if (p + 4 <= end) {
+            h ^= static_cast<uint64_t>(read32(p)) * P1;
+            h = rotl64(h, 23) * P2 + P3;
+            p += 4;
+        }
+        for (; p < end; p++) {
+            h ^= *p * P5;
+            h = rotl64(h, 11) * P1;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
+#ifdef HASH_HAVE_CRC32
+// CRC32-C computed with the hardware instruction (SSE4.2 or ARMv8 CRC),
+// 8 bytes per step. The 32-bit CRC is spread over 64 bits by a multiply.
+struct CRC32Hash {
+    static const char* name() { return "crc32c"; }
+
+    static uint64_t hash(const char* data, size_t len) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+        uint64_t crc = 0xffffffffULL;
+        size_t i = 0;
+#if defined(__SSE4_2__)
+        for (; i + 8 <= len; i += 8) crc = _mm_crc32_u64(crc, read64(p + i));
+        for (; i < len; i++) crc = _mm_crc32_u8(static_cast<uint32_t>(crc), p[i]);
+#else
+        for (; i + 8 <= len; i += 8) crc = __crc32cd(static_cast<uint32_t>(crc), read64(p + i));
+        for (; i < len; i++) crc = __crc32cb(static_cast<uint32_t>(crc), p[i]);
+#endif
+        uint64_t h = (crc | (static_cast<uint64_t>(len) << 32)) * 0x9e3779b97f4a7c15ULL;
+        return h ^ (h >> 29);
+    }
+};
+#endif
+
+#endif
@@ -5,62 +5,258 @@
 #include <cctype>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 
 #include "hash_table.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 extern int __Z10free_tableP9HashTable;
 
 using namespace std;
 
-// Node structure for the linked list
+// Control byte values. A FULL slot stores the low 7 bits of its word's hash,
+// so EMPTY and DELETED are the only values with the sign bit set.
+static const int8_t CTRL_EMPTY = -128;
+static const int8_t CTRL_DELETED = -2;
+
+// Bitmask of the positions in a control group whose byte equals tag
+static inline uint32_t match_byte(const int8_t* group, int8_t tag) {
+#ifdef __SSE2__
+    __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(tag)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 16; i++) {
+        if (group[i] == tag) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+// Bitmask of the positions in a control group that are EMPTY or DELETED
+static inline uint32_t match_free(const int8_t* group) {
+#ifdef __SSE2__
+    __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return _mm_movemask_epi8(g);
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 16; i++) {
+        if (group[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+static inline int8_t tag_of(uint64_t h) {
+    return static_cast<int8_t>(h & 0x7f);
+}
+
+// Slot index
+    void SlotIndex::reset(size_t new_capacity) {
+        capacity = new_capacity;
+        used = 0;
+        // Swap in a fresh vector so a retired index gives its memory back
+        vector<int8_t>(new_capacity, CTRL_EMPTY).swap(ctrl);
+        slots.reset(new_capacity != 0 ? new uint32_t[new_capacity] : nullptr);
+    }
+
+    // Return the first EMPTY or DELETED slot on h's probe sequence
+    size_t SlotIndex::insert_slot(uint64_t h) const {
+        size_t group_mask = capacity / 16 - 1;
+        size_t group = (h >> 7) & group_mask;
+
+        for (size_t step = 1; ; step++) {
+            uint32_t mask = match_free(&ctrl[group * 16]);
+            if (mask != 0) {
+                return group * 16 + __builtin_ctz(mask);
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    void SlotIndex::place(size_t slot, uint64_t h, uint32_t entry) {
+        if (ctrl[slot] == CTRL_EMPTY) used++;
+        ctrl[slot] = tag_of(h);
+        slots[slot] = entry;
+    }
+
+    void SlotIndex::erase(size_t slot) {
+        // If the group still has an EMPTY slot no probe ever continued past it,
+        // so the slot can go straight back to EMPTY instead of a tombstone
+        if (match_byte(&ctrl[slot - slot % 16], CTRL_EMPTY) != 0) {
+            ctrl[slot] = CTRL_EMPTY;
+            used--;
+        } else {
+            ctrl[slot] = CTRL_DELETED;
+        }
+    }
 
 // Hash table structure
 //class HashTable {
 //public:
-    HashTable::HashTable(int size) : size(size) {
-        table.resize(size, nullptr); // Initialize hash table with null pointers
+    template <typename Hasher>
+    BasicHashTable<Hasher>::BasicHashTable(int size, double max_load_factor, double min_load_factor,
+                                           bool intern_keys)
+        : max_load(max_load_factor), min_load(min_load_factor), live(0), migrate_pos(0), entry_count(0),
+          intern_keys(intern_keys), top_capacity(100), top_valid(true) {
+        // Keep some EMPTY slots so every probe terminates, and leave a gap between
+        // the two factors so a shrink is never immediately undone by a grow
+        max_load = min(max(max_load, 0.25), 0.9375);
+        min_load = min(max(min_load, 0.0), max_load / 4);
+
+        // Round the requested size up to a whole number of groups
+        min_capacity = GROUP_WIDTH;
+        while (min_capacity < static_cast<size_t>(size)) {
+            min_capacity *= 2;
+        }
+        index.reset(min_capacity);
     }
 
-    // Simple hash function to hash words into a range of [0, size-1]
-    unsigned int HashTable::hash(const string& word) {
-        unsigned int hash_value = 0;
-        for (char ch : word) {
-            hash_value = (hash_value * 521 + tolower(ch)) % size;
+    // Return the slot of idx holding word, or -1 if it is not there
+    template <typename Hasher>
+    long BasicHashTable<Hasher>::find_slot(const SlotIndex& idx, string_view word, uint64_t h) {
+        if (idx.capacity == 0) return -1;
+
+        size_t group_mask = idx.capacity / GROUP_WIDTH - 1;
+        size_t group = (h >> 7) & group_mask;
+        int8_t tag = tag_of(h);
+
+        // Triangular probing over groups visits every group exactly once
+        for (size_t step = 1; ; step++) {
+            const int8_t* g = &idx.ctrl[group * GROUP_WIDTH];
+            uint32_t mask = match_byte(g, tag);
+            while (mask != 0) {
+                size_t slot = group * GROUP_WIDTH + __builtin_ctz(mask);
+                if (entry(idx.slots[slot]).word() == word) {
+                    return static_cast<long>(slot);
+                }
+                mask &= mask - 1;
+            }
+            // An EMPTY slot in the group ends the probe sequence
+            if (match_byte(g, CTRL_EMPTY) != 0) {
+                return -1;
+            }
+            group = (group + step) & group_mask;
         }
-        return hash_value;
     }
 
-    // Insert a key-value pair into the hash table
-    void HashTable::insert(const string& word) {
-        unsigned int index = hash(word);
-        Node* current = table[index];
-
-        // Check if the word already exists in the linked list
-        while (current != nullptr) {
-            if (current->word == word) {
-                current->count++;  // Word found, increase count
-                return;
+    // Return the entry holding word in either generation, or -1
+    template <typename Hasher>
+    long BasicHashTable<Hasher>::find_entry(string_view word, uint64_t h) {
+        long slot = find_slot(index, word, h);
+        if (slot >= 0) return index.slots[slot];
+
+        slot = find_slot(old_index, word, h);
+        if (slot >= 0) return old_index.slots[slot];
+        return -1;
+    }
+
+    template <typename Hasher>
+    uint32_t BasicHashTable<Hasher>::new_entry(string_view word) {
+        uint32_t i;
+        if (!free_entries.empty()) {
+            i = free_entries.back();
+            free_entries.pop_back();
+        } else {
+            if ((entry_count & ((1u << BLOCK_SHIFT) - 1)) == 0) {
+                blocks.push_back(vector<Entry>());
+                blocks.back().reserve(1u << BLOCK_SHIFT);
             }
-            current = current->next;
+            blocks.back().push_back(Entry());
+            i = entry_count++;
+        }
+
+        Entry& e = entry(i);
+        e.length = word.size();
+        e.in_arena = intern_keys || word.size() > Entry::INLINE_LENGTH;
+        if (e.in_arena) {
+            e.arena_word = arena.store(word);
+        } else {
+            memcpy(e.inline_word, word.data(), word.size());
         }
+        e.in_top = 0;
+        e.count = 1;
+        return i;
+    }
+
+    // Retire the current index and start moving its words into a new one
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::start_resize(size_t new_capacity) {
+        // A resize requested before the previous one finished completes that one first
+        migrate(old_index.capacity);
 
-        // Word not found, insert it at the beginning of the list
-        Node* new_node = new Node(word);
-        new_node->next = table[index];
-        table[index] = new_node;
+        swap(old_index, index);
+        index.reset(new_capacity);
+        migrate_pos = 0;
+    }
+
+    // Move up to max_slots slots of the old index into the current one
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::migrate(size_t max_slots) {
+        if (old_index.capacity == 0) return;
+
+        size_t end = min(migrate_pos + max_slots, old_index.capacity);
+        for (; migrate_pos < end; migrate_pos++) {
+            if (old_index.ctrl[migrate_pos] < 0) continue;
+            uint32_t e = old_index.slots[migrate_pos];
+            uint64_t h = hash(entry(e).word());
+            index.place(index.insert_slot(h), h, e);
+            // Tombstone the old copy so a later delete in the new index can't resurrect it
+            old_index.ctrl[migrate_pos] = CTRL_DELETED;
+        }
+        if (migrate_pos == old_index.capacity) {
+            old_index.reset(0);
+        }
+    }
+
+    // Insert a key-value pair into the hash table
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::insert(string_view word) {
+        add(word, 1);
+    }
+
+    // Add count occurrences of word
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::add(string_view word, int count) {
+        migrate(MIGRATE_STEP);
+        uint64_t h = hash(word);
+        long found = find_entry(word, h);
+
+        // Check if the word already exists
+        if (found >= 0) {
+            entry(found).count += count;  // Word found, increase count
+            update_top(found);
+            return;
+        }
+
+        // Past the load limit start a resize. If tombstones make up most of
+        // the load, rebuild at the same capacity instead of growing.
+        if (index.used + 1 > index.capacity * max_load) {
+            bool mostly_tombstones = live + 1 <= index.capacity * max_load / 2;
+            start_resize(mostly_tombstones ? index.capacity : index.capacity * 2);
+        }
+
+        // Word not found, store it in the first free slot on its probe sequence
+        uint32_t e = new_entry(word);
+        entry(e).count = count;
+        index.place(index.insert_slot(h), h, e);
+        live++;
+        update_top(e);
     }
 
     // Find a word and return its count, or -1 if not found
-    int HashTable::find(const string& word) {
-        unsigned int index = hash(word);
-        Node* current = table[index];
-
-        while (current != nullptr) {
-            if (current->word == word) {
-                cout << word << " frequency: " << current -> count << endl;
-                return current->count;
-            }
-            current = current->next;
+    template <typename Hasher>
+    int BasicHashTable<Hasher>::find(string_view word) {
+        migrate(MIGRATE_STEP);
+        long found = find_entry(word, hash(word));
+
+        if (found >= 0) {
+            int count = entry(found).count;
+            cout << word << " frequency: " << count << endl;
+            return count;
         }
         cout << "Key Not Found \nKey count reset to: ";
         return -1;  // Word not found
@@ -68,73 +264,253 @@ using namespace std;
         
     }
 
-    // Delete a word from the hash table
-    void HashTable::deleteWord(const string& word) {
-        unsigned int index = hash(word);
-        Node* current = table[index];
-        Node* prev = nullptr;
-
-        while (current != nullptr) {
-            if (current->word == word) {
-                if (prev == nullptr) {
-                    table[index] = current->next;  // Word is at the head
-                } else {
-                    prev->next = current->next;  // Remove the word from the list
+    template <typename Hasher>
+    int BasicHashTable<Hasher>::lookup(string_view word) {
+        migrate(MIGRATE_STEP);
+        long found = find_entry(word, hash(word));
+        return found >= 0 ? entry(found).count : -1;
+    }
+
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::lookup_batch(const string_view* words, size_t n, int* counts) {
+        uint64_t h[BATCH_WIDTH];
+
+        for (size_t base = 0; base < n; base += BATCH_WIDTH) {
+            migrate(MIGRATE_STEP);
+            size_t width = n - base < BATCH_WIDTH ? n - base : BATCH_WIDTH;
+            size_t group_mask = index.capacity / GROUP_WIDTH - 1;
+
+            // Hash the block and start loading each word's home group
+            for (size_t i = 0; i < width; i++) {
+                h[i] = hash(words[base + i]);
+                size_t first = ((h[i] >> 7) & group_mask) * GROUP_WIDTH;
+                __builtin_prefetch(&index.ctrl[first]);
+                __builtin_prefetch(&index.slots[first]);
+            }
+
+            // Then the entry of the first tag match, which is almost always the word
+            for (size_t i = 0; i < width; i++) {
+                size_t first = ((h[i] >> 7) & group_mask) * GROUP_WIDTH;
+                uint32_t mask = match_byte(&index.ctrl[first], tag_of(h[i]));
+                if (mask != 0) {
+                    __builtin_prefetch(&entry(index.slots[first + __builtin_ctz(mask)]));
                 }
-                delete current;
-                return;
             }
-            prev = current;
-            current = current->next;
+
+            for (size_t i = 0; i < width; i++) {
+                long found = find_entry(words[base + i], h[i]);
+                counts[base + i] = found >= 0 ? entry(found).count : -1;
+            }
+        }
+    }
+
+    // Delete a word from the hash table
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::deleteWord(string_view word) {
+        migrate(MIGRATE_STEP);
+        uint64_t h = hash(word);
+
+        SlotIndex* idx = &index;
+        long slot = find_slot(index, word, h);
+        if (slot < 0) {
+            idx = &old_index;
+            slot = find_slot(old_index, word, h);
+        }
+        if (slot < 0) return;
+
+        // Arena bytes of a deleted word are only released with the table
+        uint32_t e = idx->slots[slot];
+        entry(e).count = 0;  // Marks the entry dead until it is reused
+        if (entry(e).in_top) {
+            // The next most frequent word is unknown until the heap is rebuilt
+            entry(e).in_top = 0;
+            top_valid = false;
+        }
+        free_entries.push_back(e);
+        idx->erase(slot);
+        live--;
+
+        if (min_load > 0 && old_index.capacity == 0 && index.capacity > min_capacity &&
+            live < index.capacity * min_load) {
+            start_resize(index.capacity / 2);
         }
     }
 
     // Increase the count of a word
-    void HashTable::increase(const string& word) {
-        unsigned int index = hash(word);
-        Node* current = table[index];
-
-        while (current != nullptr) {
-            if (current->word == word) {
-                current->count++;
-                return;
-            }
-            current = current->next;
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::increase(string_view word) {
+        migrate(MIGRATE_STEP);
+        long found = find_entry(word, hash(word));
+
+        if (found >= 0) {
+            entry(found).count++;
+            update_top(found);
+            return;
         }
         // If word is not found, insert it
         insert(word);
     }
 
     // Print all words and their counts
-    void HashTable::list_all_keys(ofstream& output_file) {
-        for (int i = 0; i < size; i++) {
-            Node* current = table[i];
-            while (current != nullptr) {
-                output_file << current->word << ": " << current->count << endl;
-                current = current->next;
-            }
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::list_all_keys(ofstream& output_file) {
+        for (size_t i = 0; i < entry_count; i++) {
+            Entry& e = entry(i);
+            if (e.count == 0) continue;
+            output_file << e.word() << ": " << e.count << "\n";
         }
     }
 
-    // Count the number of collisions and list statistics
-    void HashTable::collision_statistics() {
-        vector<int> bucket_sizes(size, 0);
+    // Entries are visited in order, so merging the per-chunk tables of a
+    // split corpus in chunk order reproduces the serial table's word order
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::merge(const BasicHashTable& other) {
+        for (size_t i = 0; i < other.entry_count; i++) {
+            const Entry& e = other.entry(i);
+            if (e.count == 0) continue;
+            add(e.word(), e.count);
+        }
+    }
+
+    static bool count_greater(const pair<int, uint32_t>& a, const pair<int, uint32_t>& b) {
+        return a.first > b.first;  // with the std heap algorithms this gives a min-heap
+    }
+
+    // Called after entry e's count grew: enter it into the heap if it now
+    // beats the least frequent tracked word
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::update_top(uint32_t e) {
+        Entry& en = entry(e);
+        if (en.in_top || !top_valid) return;
+
+        if (top.size() < top_capacity) {
+            top.push_back(make_pair(en.count, e));
+            push_heap(top.begin(), top.end(), count_greater);
+            en.in_top = 1;
+            return;
+        }
+        if (en.count <= top[0].first) return;
+
+        // Bring the root's snapshot up to date until the root is the true minimum
+        while (entry(top[0].second).count != top[0].first) {
+            pop_heap(top.begin(), top.end(), count_greater);
+            top.back().first = entry(top.back().second).count;
+            push_heap(top.begin(), top.end(), count_greater);
+        }
+        if (en.count <= top[0].first) return;
+
+        pop_heap(top.begin(), top.end(), count_greater);
+        entry(top.back().second).in_top = 0;
+        top.back() = make_pair(en.count, e);
+        push_heap(top.begin(), top.end(), count_greater);
+        en.in_top = 1;
+    }
+
+    // Refill the heap from every live entry
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::rebuild_top() {
+        for (size_t i = 0; i < top.size(); i++) {
+            entry(top[i].second).in_top = 0;
+        }
+        top.clear();
+        top_valid = true;
+        for (size_t i = 0; i < entry_count; i++) {
+            if (entry(i).count > 0) update_top(i);
+        }
+    }
+
+    template <typename Hasher>
+    vector<pair<string_view, int> > BasicHashTable<Hasher>::top_k(size_t k) {
+        if (k > top_capacity) {
+            top_capacity = k;
+            top_valid = false;
+        }
+        if (!top_valid) rebuild_top();
+
+        vector<pair<int, uint32_t> > sorted(top);
+        for (size_t i = 0; i < sorted.size(); i++) {
+            sorted[i].first = entry(sorted[i].second).count;
+        }
+        k = min(k, sorted.size());
+        partial_sort(sorted.begin(), sorted.begin() + k, sorted.end(), count_greater);
+
+        vector<pair<string_view, int> > result;
+        for (size_t i = 0; i < k; i++) {
+            result.push_back(make_pair(entry(sorted[i].second).word(), sorted[i].first));
+        }
+        return result;
+    }
+
+    template <typename Hasher>
+    string_view BasicHashTable<Hasher>::key(string_view word) {
+        long found = find_entry(word, hash(word));
+        return found >= 0 ? entry(found).word() : string_view();
+    }
+
+    template <typename Hasher>
+    long BasicHashTable<Hasher>::id(string_view word) {
+        migrate(MIGRATE_STEP);
+        return find_entry(word, hash(word));
+    }
+
+    template <typename Hasher>
+    size_t BasicHashTable<Hasher>::memory_usage() const {
+        size_t bytes = sizeof(*this);
+        bytes += (index.capacity + old_index.capacity) * (sizeof(int8_t) + sizeof(uint32_t));
+        bytes += blocks.capacity() * sizeof(vector<Entry>);
+        bytes += blocks.size() * (size_t(1) << BLOCK_SHIFT) * sizeof(Entry);
+        bytes += free_entries.capacity() * sizeof(uint32_t);
+        bytes += arena.bytes_reserved();
+        return bytes;
+    }
+
+    template <typename Hasher>
+    double BasicHashTable<Hasher>::load_factor() const {
+        return static_cast<double>(live) / index.capacity;
+    }
+
+    // Number of groups probed to reach slot from h's home group
+    template <typename Hasher>
+    int BasicHashTable<Hasher>::probe_length(size_t slot, uint64_t h) {
+        size_t group_mask = index.capacity / GROUP_WIDTH - 1;
+        size_t group = (h >> 7) & group_mask;
+        size_t target = slot / GROUP_WIDTH;
+        int length = 1;
+
+        for (size_t step = 1; group != target; step++) {
+            group = (group + step) & group_mask;
+            length++;
+        }
+        return length;
+    }
+
+    // Count the number of collisions and list statistics. A word collides
+    // when its home group was full and it had to be placed further along
+    // its probe sequence.
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::collision_statistics() {
+        // Finish any resize in flight so every word is in the current index
+        migrate(old_index.capacity);
+
+        vector<int> probe_lengths;
+        vector<bool> overflowed(index.capacity / GROUP_WIDTH, false);
         int total_collisions = 0;
         int max_length = 0;
         int collision_buckets = 0;
 
-        // Collect collision list sizes
-        for (int i = 0; i < size; i++) {
-            int length = 0;
-            Node* current = table[i];
-            while (current != nullptr) {
-                length++;
-                current = current->next;
-            }
-            bucket_sizes[i] = length;
+        // Collect probe lengths of every live word
+        for (size_t slot = 0; slot < index.capacity; slot++) {
+            if (index.ctrl[slot] < 0) continue;
+            uint64_t h = hash(entry(index.slots[slot]).word());
+            int length = probe_length(slot, h);
+            probe_lengths.push_back(length);
             if (length > 1) {
-                total_collisions += (length - 1);
-                collision_buckets++;
+                total_collisions++;
+                size_t home = (h >> 7) & (index.capacity / GROUP_WIDTH - 1);
+                if (!overflowed[home]) {
+                    overflowed[home] = true;
+                    collision_buckets++;
+                }
             }
             if (length > max_length) {
                 max_length = length;
@@ -142,40 +518,58 @@ using namespace std;
         }
 
         // Print basic statistics
+        cout << "Table capacity: " << index.capacity << " slots, " << live << " words" << endl;
         cout << "Total collisions: " << total_collisions << endl;
         cout << "Number of collision buckets: " << collision_buckets << endl;
-        cout << "Max length of collision lists: " << max_length << endl;
+        cout << "Max probe length (groups): " << max_length << endl;
 
-        // Variance of list lengths
+        // Variance of probe lengths
         double mean = 0;
-        for (int i = 0; i < size; i++) {
-            mean += bucket_sizes[i];
+        for (size_t i = 0; i < probe_lengths.size(); i++) {
+            mean += probe_lengths[i];
         }
-        mean /= size;
+        if (!probe_lengths.empty()) mean /= probe_lengths.size();
 
         double variance = 0;
-        for (int i = 0; i < size; i++) {
-            variance += (bucket_sizes[i] - mean) * (bucket_sizes[i] - mean);
+        for (size_t i = 0; i < probe_lengths.size(); i++) {
+            variance += (probe_lengths[i] - mean) * (probe_lengths[i] - mean);
         }
-        variance /= size;
+        if (!probe_lengths.empty()) variance /= probe_lengths.size();
 
-        cout << "Variance of list lengths: " << variance << endl;
+        cout << "Variance of probe lengths: " << variance << endl;
 
-        // Generate and print histogram of collision list lengths
-        print_histogram(bucket_sizes);
+        // Generate and print histogram of probe lengths
+        print_histogram(probe_lengths);
+    }
+
+    template <typename Hasher>
+    vector<size_t> BasicHashTable<Hasher>::probe_histogram() {
+        migrate(old_index.capacity);
+
+        vector<size_t> histogram(1, 0);
+        for (size_t slot = 0; slot < index.capacity; slot++) {
+            if (index.ctrl[slot] < 0) continue;
+            size_t length = probe_length(slot, hash(entry(index.slots[slot]).word()));
+            if (length >= histogram.size()) {
+                histogram.resize(length + 1, 0);
+            }
+            histogram[length]++;
+        }
+        return histogram;
     }
 
 //private:
 //    int size;
 //    vector<Node*> table;  // Hash table with linked lists
 
-    // Function to print the histogram of collision list lengths
-    void HashTable::print_histogram(const vector<int>& bucket_sizes) {
-        // Create a map to count frequency of each collision list length
+    // Function to print the histogram of probe lengths
+    template <typename Hasher>
+    void BasicHashTable<Hasher>::print_histogram(const vector<int>& bucket_sizes) {
+        // Create a map to count frequency of each probe length
         vector<int> histogram;
         for (int size : bucket_sizes) {
             if (size > 0) {
-                if (size >= histogram.size()) {
+                if (size >= static_cast<int>(histogram.size())) {
                     histogram.resize(size + 1, 0);
                 }
                 histogram[size]++;
@@ -183,15 +577,24 @@ using namespace std;
         }
 
         // Print the histogram
-        cout << "\nHistogram of Collision List Lengths:\n";
-        for (int i = 1; i < histogram.size(); i++) {
+        cout << "\nHistogram of Probe Lengths:\n";
+        for (size_t i = 1; i < histogram.size(); i++) {
             if (histogram[i] > 0) {
-                cout << "Length " << i << ": " << histogram[i] << " buckets\n";
+                cout << "Length " << i << ": " << histogram[i] << " words\n";
             }
         }
     }
 //};
 
+// The hash policies the table is built with
+template class BasicHashTable<PolynomialHash>;
+template class BasicHashTable<FNV1a>;
+template class BasicHashTable<WyHash>;
+template class BasicHashTable<XXHash64>;
+#ifdef HASH_HAVE_CRC32
+template class BasicHashTable<CRC32Hash>;
+#endif
+
 // Clean up the hash table
 void free_table(HashTable* ht) {
     delete ht;  // C++ will call the destructor automatically
@@ -5,38 +5,172 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <cctype>
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <algorithm>
+
+#include "hash_functions.hpp"
+#include "string_arena.hpp"
 using namespace std;
 
-#define MAXHASH 30  // Change this value to 30, 300, or 1000 based on test case
+#define MAXHASH 30  // Initial capacity hint; the table grows past it as words are added
+
+// Word/count pair, stored contiguously in the table's entry array. Words of
+// up to INLINE_LENGTH bytes are kept inside the entry; longer ones, and every
+// word of a table that interns its keys, point into the table's StringArena.
+struct Entry {
+    static const uint32_t INLINE_LENGTH = 16;
 
-struct Node {
-    string word;
+    union {
+        char inline_word[INLINE_LENGTH];
+        const char* arena_word;
+    };
+    uint32_t length : 30;
+    uint32_t in_arena : 1;
+    uint32_t in_top : 1;      // entry is in the table's top-k heap
     int count;
-    Node* next;
 
-    Node(const string& w) : word(w), count(1), next(nullptr) {}
+    string_view word() const {
+        return string_view(in_arena ? arena_word : inline_word, length);
+    }
+};
+
+// Control bytes and entry indices for one generation of the table
+struct SlotIndex {
+    size_t capacity;          // number of slots, a power of two >= 16
+    size_t used;              // slots that are not EMPTY (live words + tombstones)
+    vector<int8_t> ctrl;      // one control byte per slot
+    unique_ptr<uint32_t[]> slots;  // index into the entry array for each FULL slot,
+                                   // left uninitialized so a resize doesn't pay to clear it
+
+    SlotIndex() : capacity(0), used(0) {}
+    void reset(size_t new_capacity);
+    size_t insert_slot(uint64_t h) const;
+    void place(size_t slot, uint64_t h, uint32_t entry);
+    void erase(size_t slot);
 };
 
-class HashTable{
+// Open-addressing table with SwissTable-style control bytes. Each slot has a
+// one-byte tag (EMPTY, DELETED, or the low 7 bits of the word's hash) and the
+// tags are probed a group of 16 at a time, so most lookups touch one cache
+// line of control bytes and compare at most one word.
+//
+// The table grows once its load passes max_load_factor and, if
+// min_load_factor is non-zero, shrinks when deletions drop it below that.
+// Resizing is incremental: the old index is kept alongside the new one and
+// every subsequent operation migrates a few of its slots, so no single
+// insert pays for a full-table rehash.
+//
+// Hasher is one of the policies in hash_functions.hpp; the word is hashed
+// once per operation and mapped to a group by masking, never by modulo.
+template <typename Hasher>
+class BasicHashTable{
     public:
-        HashTable(int size);
-        unsigned int hash(const string& word);
-        void insert(const string& word);
+        BasicHashTable(int size, double max_load_factor = 0.875, double min_load_factor = 0.0,
+                       bool intern_keys = false);
+        uint64_t hash(string_view word) { return Hasher::hash(word.data(), word.size()); }
+        void insert(string_view word);
+        void add(string_view word, int count);
+
+        int find(string_view word);
+        int lookup(string_view word);  // like find, but prints nothing
+        void deleteWord(string_view word);
+        void increase(string_view word);
 
-        int find(const string& word);
-        void deleteWord(const string& word);
-        void increase(const string& word);
+        // Look up n words at once, storing each count (or -1) in counts. Words
+        // are hashed and their control groups prefetched a block at a time
+        // before any is resolved, so the cache misses of a block overlap
+        // instead of stalling one lookup after another.
+        void lookup_batch(const string_view* words, size_t n, int* counts);
         void list_all_keys(ofstream& output_file);
         void collision_statistics();
+        // Number of words at each probe length (in groups); element 0 is unused
+        vector<size_t> probe_histogram();
+
+        // Add every word of other, in other's entry order, to this table
+        void merge(const BasicHashTable& other);
+
+        // Call f(word, count) for every word, in entry order
+        template <typename F>
+        void for_each(F f) const {
+            for (size_t i = 0; i < entry_count; i++) {
+                const Entry& e = entry(i);
+                if (e.count > 0) f(e.word(), e.count);
+            }
+        }
+
+        // The table's own copy of word, or an empty view if word is absent. With
+        // intern_keys the view stays valid for the table's lifetime, even
+        // after the word is deleted.
+        string_view key(string_view word);
+
+        // Dense id of word, or -1 if it is absent. The id is the word's entry
+        // index, so ids run below id_limit() and stay fixed while the word
+        // remains in the table.
+        long id(string_view word);
+        string_view word_of(uint32_t id) const { return entry(id).word(); }
+        size_t id_limit() const { return entry_count; }
+
+        size_t size() const { return live; }
+        double load_factor() const;
+        size_t memory_usage() const;  // bytes held by the index, entries and arena
+
+        // The k most frequent words, most frequent first. Answered from a heap
+        // kept up to date by every insert, so it costs O(k log k) at any time
+        // for k up to the tracked size (initially 100); a larger k grows the
+        // tracked size with one full scan.
+        vector<pair<string_view, int> > top_k(size_t k);
     private:
-        int size;
-        vector<Node*> table;
+        static const size_t GROUP_WIDTH = 16;
+        static const size_t MIGRATE_STEP = 2 * GROUP_WIDTH;  // old slots moved per operation
+        static const size_t BLOCK_SHIFT = 10;                // 1024 entries per block
+        static const size_t BATCH_WIDTH = 16;                // lookups in flight in lookup_batch
+
+        double max_load;
+        double min_load;
+        size_t min_capacity;      // never shrink below the constructor's size
+        size_t live;              // words currently in the table
+
+        SlotIndex index;          // receives every new word
+        SlotIndex old_index;      // previous generation while a resize is in flight
+        size_t migrate_pos;       // next old_index slot to move
+
+        // Entries live in fixed-size blocks so growing never moves them
+        vector<vector<Entry> > blocks;
+        size_t entry_count;
+        vector<uint32_t> free_entries;  // dead entries available for reuse
+
+        StringArena arena;        // bytes of words that don't fit inline
+        bool intern_keys;         // store every word in the arena
+
+        // Min-heap of (count when last sifted, entry) for the most frequent
+        // words. Counts only grow, so a stale snapshot can only be too small;
+        // it is refreshed when that entry reaches the root.
+        vector<pair<int, uint32_t> > top;
+        size_t top_capacity;
+        bool top_valid;           // false after a top word is deleted, until rebuilt
+
+        void update_top(uint32_t e);
+        void rebuild_top();
+
+        Entry& entry(uint32_t i) { return blocks[i >> BLOCK_SHIFT][i & ((1u << BLOCK_SHIFT) - 1)]; }
+        const Entry& entry(uint32_t i) const { return blocks[i >> BLOCK_SHIFT][i & ((1u << BLOCK_SHIFT) - 1)]; }
+        uint32_t new_entry(string_view word);
+
+        long find_slot(const SlotIndex& idx, string_view word, uint64_t h);
+        long find_entry(string_view word, uint64_t h);
+        void start_resize(size_t new_capacity);
+        void migrate(size_t max_slots);
+        int probe_length(size_t slot, uint64_t h);
         void print_histogram(const vector<int>& bucket_sizes);
 };
 
+// The table used by the word-count program
+typedef BasicHashTable<WyHash> HashTable;
+
 void free_table(HashTable* ht);
 
-#endif
\ No newline at end of file
+#endif
@@ -6,15 +6,133 @@
 #include <cctype>
 #include <vector>
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
 
 #include "hash_table.hpp"
+#include "snapshot.hpp"
+#include "tokenizer.hpp"
+#include "word_count.hpp"
 
 using namespace std;
 
-int main() {
+// Compare the sketches' estimates with the exact table
+static void report_sketch_error(HashTable& ht, const CountMinSketch& frequencies, const HyperLogLog& distinct) {
+    double exact_distinct = ht.size();
+    double estimated_distinct = distinct.estimate();
+    cout << "\nHyperLogLog (" << distinct.memory_usage() << " bytes): " << estimated_distinct
+         << " distinct words, exact " << exact_distinct << " ("
+         << 100 * (estimated_distinct - exact_distinct) / exact_distinct << "% error, standard error "
+         << 100 * distinct.standard_error() << "%)" << endl;
+
+    double bound = frequencies.epsilon() * frequencies.total();
+    double total_over = 0;
+    uint32_t max_over = 0;
+    size_t within = 0;
+    ht.for_each([&](string_view word, int count) {
+        uint32_t over = frequencies.estimate(word) - count;
+        total_over += over;
+        max_over = max(max_over, over);
+        if (over <= bound) within++;
+    });
+    cout << "Count-Min (" << frequencies.memory_usage() << " bytes): mean overestimate "
+         << total_over / ht.size() << ", max " << max_over << ", bound epsilon * N = " << bound
+         << ", " << 100.0 * within / ht.size() << "% of words within bound" << endl;
+}
+
+// Count the n-grams of the input with ht as the word dictionary, write them
+// to ngram_counts.txt and print the most frequent
+static void report_ngrams(HashTable& ht, const MappedFile& input_file, unsigned n) {
+    HashTable ngrams(MAXHASH);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    count_ngrams(input_file.data(), input_file.size(), ht, ngrams, n);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    ofstream ngram_file("ngram_counts.txt");
+    ngrams.for_each([&](string_view key, int count) {
+        ngram_file << ngram_text(ht, key) << ": " << count << "\n";
+    });
+
+    cout << "\nCounted " << ngrams.size() << " distinct " << n << "-grams in " << seconds * 1000
+         << " ms, memory usage: " << ngrams.memory_usage() << " bytes ("
+         << static_cast<double>(ngrams.memory_usage()) / ngrams.size() << " bytes/n-gram)" << endl;
+    vector<pair<string_view, int> > top = ngrams.top_k(10);
+    cout << "Top " << top.size() << " " << n << "-grams:\n";
+    for (size_t i = 0; i < top.size(); i++) {
+        cout << ngram_text(ht, top[i].first) << ": " << top[i].second << "\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
     //cout << "0\n";
+    // Usage: run [-j threads] [-a [--epsilon e] [--delta d] [--hll-error r]]
+    //            [--ngram n] [--save-snapshot file] [input file]
+    //        run --query snapshot word...
+    // -j 0 uses every hardware thread; -a also feeds the approximate counters
+    // and reports their error against the exact table. --ngram also counts
+    // sequences of n words (up to MAX_NGRAM) into ngram_counts.txt.
+    // --save-snapshot writes the counts in a binary form that --query answers
+    // from without re-reading the text.
+    const char* path = "alice_in_wonderland.txt";
+    const char* save_path = nullptr;
+    const char* query_path = nullptr;
+    vector<const char*> positional;
+    unsigned threads = 1;
+    unsigned ngram = 0;
+    bool approx = false;
+    double epsilon = 0.001, delta = 0.01, hll_error = 0.01;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-a") == 0) {
+            approx = true;
+        } else if (strcmp(argv[i], "--epsilon") == 0 && i + 1 < argc) {
+            epsilon = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--delta") == 0 && i + 1 < argc) {
+            delta = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--hll-error") == 0 && i + 1 < argc) {
+            hll_error = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--ngram") == 0 && i + 1 < argc) {
+            char* end;
+            long n = strtol(argv[++i], &end, 10);
+            if (*end != '\0' || n < 1 || n > static_cast<long>(MAX_NGRAM)) {
+                cerr << "--ngram must be a whole number from 1 to " << MAX_NGRAM << "." << endl;
+                return 1;
+            }
+            ngram = n;
+        } else if (strcmp(argv[i], "--save-snapshot") == 0 && i + 1 < argc) {
+            save_path = argv[++i];
+        } else if (strcmp(argv[i], "--query") == 0 && i + 1 < argc) {
+            query_path = argv[++i];
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+
+    // Written so NaN, and the 0 atof returns for non-numbers, are rejected
+    if (!(epsilon > 0 && epsilon < 1) || !(delta > 0 && delta < 1) || !(hll_error > 0)) {
+        cerr << "--epsilon and --delta must be between 0 and 1, and --hll-error above 0." << endl;
+        return 1;
+    }
+
+    if (query_path) {
+        Snapshot snapshot(query_path);
+        if (!snapshot.is_open()) {
+            cerr << "Could not open snapshot." << endl;
+            return 1;
+        }
+        for (size_t i = 0; i < positional.size(); i++) {
+            cout << positional[i] << ": " << snapshot.find(positional[i]) << "\n";
+        }
+        return 0;
+    }
+    if (!positional.empty()) path = positional.back();
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+
     HashTable ht(MAXHASH);
-    ifstream input_file("alice_in_wonderland.txt");
+    MappedFile input_file(path);
     ofstream output_file("word_counts.txt");
 
     if (!input_file.is_open()) {
@@ -22,27 +140,48 @@ int main() {
         return 1;
     }
 
-    string word;
-    while (input_file >> word) {
-        // Convert to lowercase and remove non-alphabetic characters
-        word.erase(remove_if(word.begin(), word.end(), [](char c) {
-            return !isalpha(c);
-        }), word.end());
+    CountMinSketch frequencies(epsilon, delta);
+    HyperLogLog distinct(hll_error);
 
-        // Insert the cleaned word into the hash table
-        if (!word.empty()) {
-            transform(word.begin(), word.end(), word.begin(), ::tolower);
-            ht.insert(word);
-        }
+    // Words are counted lowercased with non-alphabetic characters removed
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    if (approx) {
+        threads = 1;
+        count_words_approx(input_file.data(), input_file.size(), &ht, frequencies, distinct);
+    } else {
+        count_words(input_file.data(), input_file.size(), ht, threads);
     }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
 
-    
+    double megabytes = input_file.size() / 1e6;
+    cout << "Counted " << megabytes << " MB in " << seconds * 1000 << " ms ("
+         << megabytes / seconds << " MB/s, " << threads << " thread"
+         << (threads == 1 ? "" : "s") << ")" << endl;
 
     // Output the list of words and counts
     ht.list_all_keys(output_file);
+    if (save_path && !write_snapshot(ht, save_path)) {
+        cerr << "Could not write snapshot." << endl;
+    }
 
     // Print collision statistics
     ht.collision_statistics();
+    cout << "Memory usage: " << ht.memory_usage() << " bytes ("
+         << static_cast<double>(ht.memory_usage()) / ht.size() << " bytes/word)" << endl;
+
+    vector<pair<string_view, int> > top = ht.top_k(10);
+    cout << "\nTop " << top.size() << " words:\n";
+    for (size_t i = 0; i < top.size(); i++) {
+        cout << top[i].first << ": " << top[i].second << "\n";
+    }
+
+    if (ngram > 0) {
+        report_ngrams(ht, input_file, ngram);
+    }
+
+    if (approx) {
+        report_sketch_error(ht, frequencies, distinct);
+    }
 
     input_file.close();
     output_file.close();
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cmath>
+
+#include "sketch.hpp"
+#include "hash_functions.hpp"
+
+using namespace std;
+
+static uint64_t hash_word(string_view word) {
+    return WyHash::hash(word.data(), word.size());
+}
+
+CountMinSketch::CountMinSketch(double epsilon, double delta) : width(16), depth(1), added(0) {
+    while (width < MAX_WIDTH && width < exp(1.0) / epsilon) {
+        width *= 2;
+    }
+    // Written so a NaN row count falls through to one row
+    double rows = ceil(log(1.0 / delta));
+    depth = rows >= MAX_DEPTH ? MAX_DEPTH : rows > 1 ? static_cast<size_t>(rows) : 1;
+    counters.assign(width * depth, 0);
+}
+
+// Row i uses h1 + i * h2, so one 64-bit hash serves every row
+void CountMinSketch::add(string_view word, uint32_t count) {
+    uint64_t h = hash_word(word);
+    uint32_t h1 = static_cast<uint32_t>(h);
+    uint32_t h2 = static_cast<uint32_t>(h >> 32) | 1;
+
+    for (size_t i = 0; i < depth; i++) {
+        counters[i * width + ((h1 + i * h2) & (width - 1))] += count;
+    }
+    added += count;
+}
+
+uint32_t CountMinSketch::estimate(string_view word) const {
+    uint64_t h = hash_word(word);
+    uint32_t h1 = static_cast<uint32_t>(h);
+    uint32_t h2 = static_cast<uint32_t>(h >> 32) | 1;
+    uint32_t result = UINT32_MAX;
+
+    for (size_t i = 0; i < depth; i++) {
+        result = min(result, counters[i * width + ((h1 + i * h2) & (width - 1))]);
+    }
+    return result;
+}
+
+// The epsilon actually provided by the rounded-up width
+double CountMinSketch::epsilon() const {
+    return exp(1.0) / width;
+}
+
+HyperLogLog::HyperLogLog(double error) : precision(4) {
+    while (precision < 18 && 1.04 / sqrt(static_cast<double>(1u << precision)) > error) {
+        precision++;
+    }
+    registers.assign(size_t(1) << precision, 0);
+}
+
+// The top bits pick a register, which keeps the longest run of leading
+// zeros (plus one) seen in the remaining bits
+void HyperLogLog::add(string_view word) {
+    uint64_t h = hash_word(word);
+    size_t reg = h >> (64 - precision);
+    uint64_t rest = (h << precision) | (uint64_t(1) << (precision - 1));
+    uint8_t rank = __builtin_clzll(rest) + 1;
+    registers[reg] = max(registers[reg], rank);
+}
+
+double HyperLogLog::estimate() const {
+    double m = registers.size();
+    double sum = 0;
+    size_t zeros = 0;
+    for (size_t i = 0; i < registers.size(); i++) {
+        sum += ldexp(1.0, -registers[i]);
+        if (registers[i] == 0) zeros++;
+    }
+
+    double alpha = m == 16 ? 0.673 : m == 32 ? 0.697 : m == 64 ? 0.709 : 0.7213 / (1 + 1.079 / m);
+    double raw = alpha * m * m / sum;
+
+    // Small cardinalities are estimated better by linear counting
+    if (raw <= 2.5 * m && zeros > 0) {
+        return m * log(m / zeros);
+    }
+    return raw;
+}
+
+double HyperLogLog::standard_error() const {
+    return 1.04 / sqrt(static_cast<double>(registers.size()));
+}
@@ -0,0 +1,52 @@
+#ifndef SKETCH_H
+#define SKETCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+// Count-Min sketch for per-word frequencies in fixed memory. estimate() never
+// undercounts, and with probability 1 - delta it overcounts by at most
+// epsilon times the total number of words added. epsilon and delta belong
+// in (0, 1); the width and depth they ask for are capped at MAX_WIDTH and
+// MAX_DEPTH, and epsilon() reports the bound actually provided.
+class CountMinSketch {
+    public:
+        static const size_t MAX_WIDTH = size_t(1) << 22;
+        static const size_t MAX_DEPTH = 16;
+
+        CountMinSketch(double epsilon, double delta);
+
+        void add(string_view word, uint32_t count = 1);
+        uint32_t estimate(string_view word) const;
+
+        uint64_t total() const { return added; }
+        double epsilon() const;
+        size_t memory_usage() const { return counters.size() * sizeof(uint32_t); }
+    private:
+        size_t width;       // counters per row, a power of two >= e / epsilon
+        size_t depth;       // rows, ceil(ln(1 / delta))
+        uint64_t added;
+        vector<uint32_t> counters;
+};
+
+// HyperLogLog estimate of the number of distinct words. The relative
+// standard error is about 1.04 / sqrt(registers); the constructor picks the
+// smallest power-of-two register count that meets the requested error.
+class HyperLogLog {
+    public:
+        HyperLogLog(double error);
+
+        void add(string_view word);
+        double estimate() const;
+
+        double standard_error() const;
+        size_t memory_usage() const { return registers.size(); }
+    private:
+        int precision;      // log2 of the register count
+        vector<uint8_t> registers;
+};
+
+#endif
@@ -0,0 +1,131 @@
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <vector>
+
+#include "snapshot.hpp"
+#include "hash_functions.hpp"
+
+using namespace std;
+
+static const char SNAPSHOT_MAGIC[8] = {'W', 'C', 'S', 'N', 'A', 'P', '\0', '\0'};
+static const uint32_t SNAPSHOT_VERSION = 1;
+
+static uint64_t hash_word(string_view word) {
+    return WyHash::hash(word.data(), word.size());
+}
+
+bool write_snapshot(const HashTable& ht, const char* path) {
+    // Build the offset, count and index arrays in memory; the blob is
+    // streamed straight from the table afterwards
+    vector<uint32_t> offsets(1, 0);
+    vector<uint32_t> counts;
+    uint64_t blob_size = 0;
+    ht.for_each([&](string_view word, int count) {
+        blob_size += word.size();
+        offsets.push_back(static_cast<uint32_t>(blob_size));
+        counts.push_back(count);
+    });
+    if (blob_size > UINT32_MAX) {
+        cerr << "Snapshot blob is larger than 4 GB" << endl;
+        return false;
+    }
+
+    uint64_t index_size = 16;
+    while (index_size < 2 * counts.size()) {
+        index_size *= 2;
+    }
+    vector<uint32_t> index(index_size, 0);
+    uint32_t i = 0;
+    ht.for_each([&](string_view word, int) {
+        size_t slot = hash_word(word) & (index_size - 1);
+        while (index[slot] != 0) {
+            slot = (slot + 1) & (index_size - 1);
+        }
+        index[slot] = ++i;
+    });
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.words = counts.size();
+    header.index_size = index_size;
+    header.blob_size = blob_size;
+
+    ofstream out(path, ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+    out.write(reinterpret_cast<const char*>(counts.data()), counts.size() * sizeof(uint32_t));
+    out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(uint32_t));
+    ht.for_each([&](string_view word, int) {
+        out.write(word.data(), word.size());
+    });
+    out.close();
+    return !out.fail();
+}
+
+Snapshot::Snapshot(const char* path)
+    : file(path), header(nullptr), offsets(nullptr), counts(nullptr), index(nullptr), blob(nullptr) {
+    if (!file.is_open() || file.size() < sizeof(SnapshotHeader)) return;
+
+    const SnapshotHeader* h = reinterpret_cast<const SnapshotHeader*>(file.data());
+    if (memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) != 0 || h->version != SNAPSHOT_VERSION) {
+        cerr << path << " is not a word-count snapshot" << endl;
+        return;
+    }
+
+    // Reject files whose arrays would run past the end of the mapping. The
+    // header counts are untrusted, so every step is checked for overflow.
+    uint64_t entries, expected;
+    bool sized = !__builtin_mul_overflow(h->words, 2, &entries) &&
+                 !__builtin_add_overflow(entries, 1, &entries) &&
+                 !__builtin_add_overflow(entries, h->index_size, &entries) &&
+                 !__builtin_mul_overflow(entries, sizeof(uint32_t), &expected) &&
+                 !__builtin_add_overflow(expected, sizeof(SnapshotHeader), &expected) &&
+                 !__builtin_add_overflow(expected, h->blob_size, &expected);
+    if (!sized || expected != file.size() || (h->index_size & (h->index_size - 1)) != 0 ||
+        h->index_size <= h->words) {
+        cerr << path << " is truncated or corrupt" << endl;
+        return;
+    }
+
+    const uint32_t* o = reinterpret_cast<const uint32_t*>(h + 1);
+    const uint32_t* x = o + 2 * h->words + 1;
+
+    // Every word must lie inside the blob, and every index entry must name a
+    // word. At most words entries may be used, so find always reaches an
+    // empty slot.
+    bool valid = o[0] == 0 && o[h->words] == h->blob_size;
+    for (uint64_t i = 0; valid && i < h->words; i++) {
+        valid = o[i] <= o[i + 1];
+    }
+    uint64_t used = 0;
+    for (uint64_t slot = 0; valid && slot < h->index_size; slot++) {
+        if (x[slot] != 0) used++;
+        valid = x[slot] <= h->words && used <= h->words;
+    }
+    if (!valid) {
+        cerr << path << " is truncated or corrupt" << endl;
+        return;
+    }
+
+    header = h;
+    offsets = o;
+    counts = offsets + h->words + 1;
+    index = x;
+    blob = reinterpret_cast<const char*>(index + h->index_size);
+}
+
+string_view Snapshot::word(size_t i) const {
+    return string_view(blob + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+int Snapshot::find(string_view w) const {
+    size_t mask = header->index_size - 1;
+    for (size_t slot = hash_word(w) & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+        size_t i = index[slot] - 1;
+        if (word(i) == w) return counts[i];
+    }
+    return -1;
+}
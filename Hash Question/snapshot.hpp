@@ -0,0 +1,61 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "hash_table.hpp"
+#include "tokenizer.hpp"
+using namespace std;
+
+// Binary word-count snapshot. The file is laid out so it can be mapped and
+// queried in place:
+//
+//   SnapshotHeader
+//   uint32_t offsets[words + 1]   start of each word in the blob
+//   uint32_t counts[words]
+//   uint32_t index[index_size]    word number + 1 (0 = empty), linear probing
+//                                 on the word's WyHash value
+//   char     blob[blob_size]      the words back to back
+//
+// Integers are stored in the writer's byte order.
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t words;
+    uint64_t index_size;     // a power of two, at least twice words
+    uint64_t blob_size;
+};
+
+// Write every word of ht and its count to path in one sequential pass.
+// Returns false if the file can't be written.
+bool write_snapshot(const HashTable& ht, const char* path);
+
+// Read-only view of a snapshot file. Loading checks the header against the
+// file size and every offset and index entry against the arrays they point
+// into, so a corrupt file fails to open rather than being read out of bounds.
+class Snapshot {
+    public:
+        Snapshot(const char* path);
+
+        bool is_open() const { return header != nullptr; }
+        size_t size() const { return header->words; }
+
+        // Count of word, or -1 if it is not in the snapshot. Unlike
+        // HashTable::find this prints nothing, so it can serve queries.
+        int find(string_view word) const;
+
+        string_view word(size_t i) const;
+        int count(size_t i) const { return counts[i]; }
+    private:
+        MappedFile file;
+        const SnapshotHeader* header;
+        const uint32_t* offsets;
+        const uint32_t* counts;
+        const uint32_t* index;
+        const char* blob;
+};
+
+#endif
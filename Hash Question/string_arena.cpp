@@ -0,0 +1,31 @@
+#include <algorithm>
+#include <cstring>
+
+#include "string_arena.hpp"
+
+using namespace std;
+
+StringArena::StringArena(size_t max_block_size)
+    : next(nullptr), left(0), block_size(256), max_block_size(max_block_size), reserved(0) {}
+
+const char* StringArena::store(string_view s) {
+    if (s.size() > left) {
+        // Oversized strings get a block of their own so the current block keeps its space
+        size_t size = max(block_size, s.size());
+        blocks.push_back(unique_ptr<char[]>(new char[size]));
+        reserved += size;
+        if (size > block_size) {
+            memcpy(blocks.back().get(), s.data(), s.size());
+            return blocks.back().get();
+        }
+        next = blocks.back().get();
+        left = size;
+        block_size = min(2 * block_size, max_block_size);
+    }
+
+    char* copy = next;
+    memcpy(copy, s.data(), s.size());
+    next += s.size();
+    left -= s.size();
+    return copy;
+}
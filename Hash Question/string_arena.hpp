@@ -0,0 +1,29 @@
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+// Bump allocator for string bytes. Copies are packed back to back into blocks
+// that start small and double up to max_block_size, and are never moved or
+// freed individually, so a pointer returned by store() stays valid for the
+// arena's lifetime.
+class StringArena {
+    public:
+        StringArena(size_t max_block_size = 64 * 1024);
+
+        const char* store(string_view s);
+        size_t bytes_reserved() const { return reserved; }
+    private:
+        vector<unique_ptr<char[]> > blocks;
+        char* next;
+        size_t left;
+        size_t block_size;      // size of the next block
+        size_t max_block_size;
+        size_t reserved;
+};
+
+#endif
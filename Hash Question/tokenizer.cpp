@@ -0,0 +1,133 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+
+#include "tokenizer.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+MappedFile::MappedFile(const char* path) : fd(-1), addr(nullptr), length(0) {
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close();
+        return;
+    }
+    length = st.st_size;
+    if (length == 0) return;  // mmap rejects empty mappings; an empty file has no words
+
+    void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+        close();
+        return;
+    }
+    addr = static_cast<const char*>(p);
+    madvise(p, length, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+void MappedFile::close() {
+    if (addr != nullptr) munmap(const_cast<char*>(addr), length);
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    addr = nullptr;
+    length = 0;
+}
+
+static const size_t BLOCK = 16;
+
+// Classify BLOCK bytes: bit i of alpha is set if p[i] is a letter, bit i of
+// space if it is whitespace (the C locale's isalpha/isspace). lowered gets
+// p[i] | 0x20, which is the lowercase form of every letter.
+static inline void classify(const char* p, uint32_t& alpha, uint32_t& space, char* lowered) {
+#ifdef __SSE2__
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lowered), lower);
+
+    // Unsigned range checks done as signed compares after biasing by 0x80
+    __m128i letter = _mm_cmplt_epi8(_mm_sub_epi8(lower, _mm_set1_epi8(static_cast<char>('a' + 0x80))),
+                                    _mm_set1_epi8(static_cast<char>(-0x80 + 26)));
+    __m128i control = _mm_cmplt_epi8(_mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>('\t' + 0x80))),
+                                     _mm_set1_epi8(static_cast<char>(-0x80 + 5)));
+    __m128i blank = _mm_or_si128(control, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+
+    alpha = _mm_movemask_epi8(letter);
+    space = _mm_movemask_epi8(blank);
+#else
+    alpha = 0;
+    space = 0;
+    for (size_t i = 0; i < BLOCK; i++) {
+        unsigned char c = p[i];
+        lowered[i] = c | 0x20;
+        if (static_cast<unsigned char>((c | 0x20) - 'a') < 26) alpha |= 1u << i;
+        if (c == ' ' || static_cast<unsigned char>(c - '\t') < 5) space |= 1u << i;
+    }
+#endif
+}
+
+Tokenizer::Tokenizer(const char* data, size_t size) : pos(data), end(data + size), buffer(64) {}
+
+bool Tokenizer::next(string_view& word) {
+    size_t len = 0;
+    char lowered[BLOCK];
+    char tail[BLOCK];
+
+    while (pos < end) {
+        const char* block = pos;
+        size_t n = BLOCK;
+
+        // Pad the last partial block with spaces so it classifies the same way
+        if (static_cast<size_t>(end - pos) < BLOCK) {
+            n = end - pos;
+            memset(tail, ' ', BLOCK);
+            memcpy(tail, pos, n);
+            block = tail;
+        }
+
+        uint32_t alpha, space;
+        classify(block, alpha, space, lowered);
+        uint32_t other = ~(alpha | space) & 0xffff;
+
+        if (buffer.size() < len + BLOCK) buffer.resize(2 * buffer.size() + BLOCK);
+
+        // Walk the block one run of same-class bytes at a time
+        size_t i = 0;
+        while (i < n) {
+            if ((alpha >> i) & 1) {
+                size_t run = __builtin_ctz(~(alpha >> i));
+                memcpy(&buffer[len], lowered + i, run);
+                len += run;
+                i += run;
+            } else if ((space >> i) & 1) {
+                if (len > 0) {
+                    pos += i;
+                    word = string_view(buffer.data(), len);
+                    return true;
+                }
+                i += __builtin_ctz(~(space >> i));
+            } else {
+                // Punctuation and other bytes are dropped without ending the word
+                i += __builtin_ctz(~(other >> i));
+            }
+        }
+        pos += n;
+    }
+
+    if (len > 0) {
+        word = string_view(buffer.data(), len);
+        return true;
+    }
+    return false;
+}
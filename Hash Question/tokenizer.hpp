@@ -0,0 +1,46 @@
+#ifndef TOKENIZER_H
+#define TOKENIZER_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+// Read-only memory mapping of a whole file
+class MappedFile {
+    public:
+        MappedFile(const char* path);
+        ~MappedFile();
+
+        bool is_open() const { return fd >= 0; }
+        const char* data() const { return addr; }
+        size_t size() const { return length; }
+        void close();
+    private:
+        int fd;
+        const char* addr;
+        size_t length;
+
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+};
+
+// Splits text into words the same way `ifstream >> word` followed by
+// stripping non-alphabetic characters and lowercasing does, without
+// allocating per word. Bytes are classified 16 at a time (SSE2 when
+// available) and runs of letters are copied, already lowercased, into a
+// buffer that is reused for every word.
+class Tokenizer {
+    public:
+        Tokenizer(const char* data, size_t size);
+
+        // Store the next word in word and return true, or return false at the
+        // end of the input. word stays valid until the next call.
+        bool next(string_view& word);
+    private:
+        const char* pos;
+        const char* end;
+        vector<char> buffer;
+};
+
+#endif
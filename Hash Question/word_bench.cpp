@@ -0,0 +1,244 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/resource.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "hash_table.hpp"
+#include "tokenizer.hpp"
+#include "zipf.hpp"
+
+using namespace std;
+
+// Word-count regression benchmark. Every workload is run over each corpus
+// and table size and reported as one CSV row on stdout (find_hit_batch is
+// find_hit through lookup_batch):
+//
+//   corpus,initial_capacity,workload,ops,ns_per_op,cache_misses_per_op,
+//   mean_probe,max_probe,probe_histogram,peak_rss_kb
+//
+// cache_misses_per_op is NA where perf_event_open is unavailable. The probe
+// columns describe the table the workload ran against, and are empty for
+// tokenize and for insert, which builds it; probe_histogram is
+// "length:words" pairs separated by ';'. peak_rss_kb is the process's
+// high-water mark so far, so it only grows down the report.
+
+// Hardware cache-miss counter for this thread, if the kernel allows it
+class CacheMissCounter {
+    public:
+        CacheMissCounter() : fd(-1) {
+#ifdef __linux__
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+        }
+        ~CacheMissCounter() {
+#ifdef __linux__
+            if (fd >= 0) ::close(fd);
+#endif
+        }
+
+        bool available() const { return fd >= 0; }
+
+        void start() {
+#ifdef __linux__
+            if (fd < 0) return;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        }
+
+        // Misses since start(), or 0 if unavailable
+        uint64_t stop() {
+            uint64_t count = 0;
+#ifdef __linux__
+            if (fd < 0) return 0;
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &count, sizeof(count)) != sizeof(count)) count = 0;
+#endif
+            return count;
+        }
+    private:
+        int fd;
+};
+
+struct Corpus {
+    string name;
+    string text;              // owned text; empty when mapped from a file
+    const char* data;
+    size_t size;
+    size_t vocabulary;        // distinct words, filled in after tokenizing
+};
+
+static CacheMissCounter cache_misses;
+static string probe_columns = ",,";  // mean,max,histogram of the current table
+
+static long peak_rss_kb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Run f once, timed and counted, and print its row
+template <typename F>
+void measure(const string& corpus, size_t capacity, const char* workload, size_t ops, F f) {
+    cache_misses.start();
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    uint64_t misses = cache_misses.stop();
+
+    cout << corpus << "," << capacity << "," << workload << "," << ops << "," << ns / ops << ",";
+    if (cache_misses.available()) {
+        cout << static_cast<double>(misses) / ops;
+    } else {
+        cout << "NA";
+    }
+    cout << "," << probe_columns << "," << peak_rss_kb() << endl;
+}
+
+static void describe_probes(HashTable& ht) {
+    vector<size_t> histogram = ht.probe_histogram();
+    size_t words = 0;
+    double total = 0;
+    ostringstream pairs;
+    for (size_t i = 1; i < histogram.size(); i++) {
+        words += histogram[i];
+        total += static_cast<double>(i) * histogram[i];
+        if (histogram[i] == 0) continue;
+        if (pairs.tellp() > 0) pairs << ";";
+        pairs << i << ":" << histogram[i];
+    }
+    ostringstream columns;
+    columns << (words ? total / words : 0) << "," << histogram.size() - 1 << "," << pairs.str();
+    probe_columns = columns.str();
+}
+
+// Zipf-distributed synthetic text: tokens words drawn from vocabulary ranks
+static string zipf_text(size_t vocabulary, size_t tokens, uint64_t seed) {
+    ZipfGenerator zipf(vocabulary, 1.0, seed);
+    string text;
+    for (size_t i = 0; i < tokens; i++) {
+        text += synthetic_word(zipf.next());
+        text += ' ';
+    }
+    return text;
+}
+
+static void run_corpus(Corpus& corpus) {
+    // Tokenize once untimed to keep the words, then time a second pass
+    vector<string> words;
+    Tokenizer collect(corpus.data, corpus.size);
+    string_view word;
+    while (collect.next(word)) {
+        words.push_back(string(word));
+    }
+
+    probe_columns = ",,";
+    measure(corpus.name, 0, "tokenize", words.size(), [&]() {
+        Tokenizer tokenizer(corpus.data, corpus.size);
+        string_view w;
+        size_t n = 0;
+        while (tokenizer.next(w)) n += w.size();
+        if (n == 0) cerr << "empty corpus" << endl;
+    });
+
+    // Digits never survive tokenizing, so these are guaranteed misses
+    vector<string> misses(words.size());
+    for (size_t i = 0; i < words.size(); i++) {
+        misses[i] = words[i] + "0";
+    }
+
+    {
+        HashTable ht(MAXHASH);
+        for (size_t i = 0; i < words.size(); i++) ht.insert(words[i]);
+        corpus.vocabulary = ht.size();
+    }
+
+    // From the default hint, so growth is included, and presized to the vocabulary
+    size_t capacities[] = {MAXHASH, corpus.vocabulary};
+    for (size_t c = 0; c < 2; c++) {
+        size_t capacity = capacities[c];
+        HashTable ht(capacity);
+
+        probe_columns = ",,";
+        measure(corpus.name, capacity, "insert", words.size(), [&]() {
+            for (size_t i = 0; i < words.size(); i++) ht.insert(words[i]);
+        });
+        describe_probes(ht);
+
+        long checksum = 0;
+        measure(corpus.name, capacity, "find_hit", words.size(), [&]() {
+            for (size_t i = 0; i < words.size(); i++) checksum += ht.lookup(words[i]);
+        });
+        vector<string_view> views(words.begin(), words.end());
+        vector<int> counts(views.size());
+        measure(corpus.name, capacity, "find_hit_batch", views.size(), [&]() {
+            ht.lookup_batch(views.data(), views.size(), counts.data());
+        });
+        for (size_t i = 0; i < counts.size(); i++) checksum += counts[i];
+        measure(corpus.name, capacity, "find_miss", misses.size(), [&]() {
+            for (size_t i = 0; i < misses.size(); i++) checksum += ht.lookup(misses[i]);
+        });
+
+        ofstream null_file("/dev/null");
+        measure(corpus.name, capacity, "list", ht.size(), [&]() {
+            ht.list_all_keys(null_file);
+            null_file.flush();
+        });
+
+        vector<string> distinct;
+        ht.for_each([&](string_view w, int) { distinct.push_back(string(w)); });
+        measure(corpus.name, capacity, "delete", distinct.size(), [&]() {
+            for (size_t i = 0; i < distinct.size(); i++) ht.deleteWord(distinct[i]);
+        });
+        if (checksum == 0) cerr << "no hits" << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: word_bench [text file] [tokens per synthetic corpus]
+    const char* path = argc > 1 ? argv[1] : "alice_in_wonderland.txt";
+    size_t tokens = argc > 2 ? strtoul(argv[2], nullptr, 10) : 2000000;
+
+    MappedFile input_file(path);
+    if (!input_file.is_open()) {
+        cerr << "Could not open " << path << endl;
+        return 1;
+    }
+
+    cout << "corpus,initial_capacity,workload,ops,ns_per_op,cache_misses_per_op,"
+            "mean_probe,max_probe,probe_histogram,peak_rss_kb" << endl;
+
+    Corpus text = {"alice", "", input_file.data(), input_file.size(), 0};
+    run_corpus(text);
+
+    // Small, medium and large vocabularies, so the table ranges from cache
+    // resident to well past the last-level cache
+    size_t vocabularies[] = {1000, 100000, 1000000};
+    for (size_t v = 0; v < 3; v++) {
+        Corpus zipf = {"zipf" + to_string(vocabularies[v]), zipf_text(vocabularies[v], tokens, 42 + v), nullptr, 0, 0};
+        zipf.data = zipf.text.data();
+        zipf.size = zipf.text.size();
+        run_corpus(zipf);
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "word_count.hpp"
+#include "tokenizer.hpp"
+
+using namespace std;
+
+static void count_chunk(const char* begin, const char* end, HashTable* ht) {
+    Tokenizer tokenizer(begin, end - begin);
+    string_view word;
+    while (tokenizer.next(word)) {
+        ht->insert(word);
+    }
+}
+
+static bool is_space(char c) {
+    return c == ' ' || static_cast<unsigned char>(c - '\t') < 5;
+}
+
+void count_words(const char* data, size_t size, HashTable& ht, unsigned threads) {
+    if (threads <= 1 || size < threads) {
+        count_chunk(data, data + size, &ht);
+        return;
+    }
+
+    // Chunk i ends at the first whitespace byte at or after i * size / threads,
+    // so no word straddles two chunks
+    vector<const char*> bounds(threads + 1);
+    bounds[0] = data;
+    bounds[threads] = data + size;
+    for (unsigned i = 1; i < threads; i++) {
+        const char* p = max(data + size / threads * i, bounds[i - 1]);
+        while (p < data + size && !is_space(*p)) p++;
+        bounds[i] = p;
+    }
+
+    // The first chunk is counted straight into ht
+    vector<unique_ptr<HashTable> > partial(threads);
+    vector<thread> workers;
+    for (unsigned i = 1; i < threads; i++) {
+        partial[i].reset(new HashTable(MAXHASH));
+        workers.push_back(thread(count_chunk, bounds[i], bounds[i + 1], partial[i].get()));
+    }
+    count_chunk(bounds[0], bounds[1], &ht);
+
+    for (unsigned i = 1; i < threads; i++) {
+        workers[i - 1].join();
+        ht.merge(*partial[i]);
+        partial[i].reset();
+    }
+}
+
+void count_words_approx(const char* data, size_t size, HashTable* exact, CountMinSketch& frequencies,
+                        HyperLogLog& distinct) {
+    Tokenizer tokenizer(data, size);
+    string_view word;
+    while (tokenizer.next(word)) {
+        frequencies.add(word);
+        distinct.add(word);
+        if (exact != nullptr) exact->insert(word);
+    }
+}
+
+void count_ngrams(const char* data, size_t size, HashTable& dictionary, HashTable& ngrams, unsigned n) {
+    assert(n >= 1 && n <= MAX_NGRAM);
+    uint32_t window[MAX_NGRAM] = {0};
+    size_t seen = 0;
+
+    Tokenizer tokenizer(data, size);
+    string_view word;
+    while (tokenizer.next(word)) {
+        long id = dictionary.id(word);
+        if (id < 0) continue;  // not in the dictionary
+
+        // Slide the window of the last n ids along by one word
+        memmove(window, window + 1, (n - 1) * sizeof(uint32_t));
+        window[n - 1] = static_cast<uint32_t>(id);
+        if (++seen >= n) {
+            ngrams.insert(string_view(reinterpret_cast<const char*>(window), n * sizeof(uint32_t)));
+        }
+    }
+}
+
+string ngram_text(const HashTable& dictionary, string_view key) {
+    string text;
+    for (size_t i = 0; i + sizeof(uint32_t) <= key.size(); i += sizeof(uint32_t)) {
+        uint32_t id;
+        memcpy(&id, key.data() + i, sizeof(id));
+        if (i > 0) text += ' ';
+        text += dictionary.word_of(id);
+    }
+    return text;
+}
@@ -0,0 +1,36 @@
+#ifndef WORD_COUNT_H
+#define WORD_COUNT_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "hash_table.hpp"
+#include "sketch.hpp"
+
+// Count every word of data[0, size) into ht. With more than one thread the
+// input is split into chunks on whitespace, each chunk is counted into its
+// own table, and the tables are merged into ht in chunk order, which gives
+// ht the same contents and word order as a single-threaded count.
+void count_words(const char* data, size_t size, HashTable& ht, unsigned threads);
+
+// Feed every word of data[0, size) to the sketches, and to exact as well
+// unless it is null
+void count_words_approx(const char* data, size_t size, HashTable* exact, CountMinSketch& frequencies,
+                        HyperLogLog& distinct);
+
+// Longest n-gram count_ngrams accepts. Keys are n packed 32-bit word ids, so
+// up to this length they fit inline in a table entry.
+const unsigned MAX_NGRAM = Entry::INLINE_LENGTH / sizeof(uint32_t);
+
+// Count the n-grams of data[0, size) into ngrams. Each n-gram is keyed on the
+// ids dictionary gives its words rather than on their text, so a key is 4n
+// bytes however long the words are. dictionary must already hold every word
+// of data, e.g. from count_words over the same input. n must be between 1
+// and MAX_NGRAM.
+void count_ngrams(const char* data, size_t size, HashTable& dictionary, HashTable& ngrams, unsigned n);
+
+// The words of an n-gram key from count_ngrams, separated by spaces
+string ngram_text(const HashTable& dictionary, string_view key);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef ZIPF_H
+#define ZIPF_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Draws ranks 0..n-1 with probability proportional to 1 / (rank + 1)^s
+class ZipfGenerator {
+    public:
+        ZipfGenerator(size_t n, double s, uint64_t seed) : cdf(n), rng(seed), uniform(0.0, 1.0) {
+            double total = 0;
+            for (size_t i = 0; i < n; i++) {
+                total += 1.0 / pow(static_cast<double>(i + 1), s);
+                cdf[i] = total;
+            }
+            for (size_t i = 0; i < n; i++) {
+                cdf[i] /= total;
+            }
+        }
+
+        size_t next() {
+            size_t rank = lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+            return min(rank, cdf.size() - 1);
+        }
+    private:
+        vector<double> cdf;
+        mt19937_64 rng;
+        uniform_real_distribution<double> uniform;
+};
+
+// A distinct lowercase word for every rank: bijective base 26, so rank 0 is
+// "a", rank 25 is "z", rank 26 is "aa"
+inline string synthetic_word(size_t rank) {
+    string word;
+    for (size_t n = rank + 1; n > 0; n = (n - 1) / 26) {
+        word += static_cast<char>('a' + (n - 1) % 26);
+    }
+    return word;
+}
+
+#endif
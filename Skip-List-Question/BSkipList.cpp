@@ -0,0 +1,214 @@
+#include "BSkipList.hpp"
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+static_assert(BSkipList::BLOCK % 4 == 0, "blocks are compared four keys at a time");
+
+// Number of keys in a block less than value, which is also where value is
+// or would go. Unused slots hold INT_MAX, which is never less than value, so
+// the whole block can be compared.
+static int countLess(const int* keys, int value) {
+#ifdef __SSE2__
+    __m128i v = _mm_set1_epi32(value);
+    int mask = 0;
+    for (int i = 0; i < BSkipList::BLOCK; i += 4) {
+        __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+        mask |= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(k, v))) << i;
+    }
+    return __builtin_popcount(mask);
+#else
+    int n = 0;
+    for (int i = 0; i < BSkipList::BLOCK; i++) {
+        n += keys[i] < value;
+    }
+    return n;
+#endif
+}
+
+BSkipList::BSkipList(int maxLevel) : update(maxLevel, nullptr) {
+    this->maxLevel = maxLevel;
+    this->level = 0;
+    this->length = 0;
+    this->randomState = 0x9e3779b97f4a7c15ULL;
+    header = allocate(maxLevel);
+}
+
+BSkipList::~BSkipList() {
+    Node* current = header;
+    while (current != nullptr) {
+        Node* next = current->forward[0];
+        release(current);
+        current = next;
+    }
+}
+
+// An empty node with `level` null forward pointers
+BSkipList::Node* BSkipList::allocate(int level) {
+    Node* node = static_cast<Node*>(::operator new(offsetof(Node, forward) + level * sizeof(Node*)));
+    for (int i = 0; i < BLOCK; i++) {
+        node->keys[i] = INT_MAX;
+    }
+    node->count = 0;
+    node->level = level;
+    for (int i = 0; i < level; i++) {
+        node->forward[i] = nullptr;
+    }
+    return node;
+}
+
+void BSkipList::release(Node* node) {
+    ::operator delete(node);
+}
+
+// xorshift64*; each level is kept with probability 1/2
+int BSkipList::randomLevel() {
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    uint64_t bits = randomState * 0x2545f4914f6cdd1dULL;
+    int lvl = 1 + __builtin_ctzll(bits | (1ULL << 63));
+    return lvl < maxLevel ? lvl : maxLevel;
+}
+
+// The last node whose smallest key is <= value, or header if there is none
+BSkipList::Node* BSkipList::findBlock(int value) const {
+    Node* current = header;
+    for (int i = level - 1; i >= 0; i--) {
+        while (current->forward[i] && current->forward[i]->keys[0] <= value) {
+            current = current->forward[i];
+        }
+    }
+    return current;
+}
+
+bool BSkipList::search(int value) const {
+    Node* node = findBlock(value);
+    if (node == header) {
+        return false;
+    }
+    int pos = countLess(node->keys, value);
+    return pos < node->count && node->keys[pos] == value;
+}
+
+// Link node in right after prev at level 0. At each higher level, prev is
+// the predecessor if it reaches that level, and otherwise update[i] is: no
+// node of that level lies between the two.
+void BSkipList::linkAfter(Node* node, Node* prev) {
+    if (node->level > level) {
+        for (int i = level; i < node->level; i++) {
+            update[i] = header;
+        }
+        level = node->level;
+    }
+    for (int i = 0; i < node->level; i++) {
+        Node* pred = prev->level > i ? prev : update[i];
+        node->forward[i] = pred->forward[i];
+        pred->forward[i] = node;
+    }
+}
+
+bool BSkipList::insert(int value) {
+    // Find the block value belongs in, and the path to it
+    Node* current = header;
+    for (int i = level - 1; i >= 0; i--) {
+        while (current->forward[i] && current->forward[i]->keys[0] <= value) {
+            current = current->forward[i];
+        }
+        update[i] = current;
+    }
+
+    Node* node = current;
+    if (node != header) {
+        int pos = countLess(node->keys, value);
+        if (pos < node->count && node->keys[pos] == value) {
+            return false;
+        }
+    } else if (header->forward[0] != nullptr) {
+        // value is below every key, so it starts the first block
+        node = header->forward[0];
+    } else {
+        node = allocate(randomLevel());
+        linkAfter(node, header);
+    }
+
+    // Split a full block, moving its upper half to a new node after it
+    if (node->count == BLOCK) {
+        Node* upper = allocate(randomLevel());
+        int half = BLOCK / 2;
+        memcpy(upper->keys, node->keys + half, (BLOCK - half) * sizeof(int));
+        for (int i = half; i < BLOCK; i++) {
+            node->keys[i] = INT_MAX;
+        }
+        upper->count = BLOCK - half;
+        node->count = half;
+        linkAfter(upper, node);
+        if (value > upper->keys[0]) {
+            node = upper;
+        }
+    }
+
+    int pos = countLess(node->keys, value);
+    memmove(node->keys + pos + 1, node->keys + pos, (node->count - pos) * sizeof(int));
+    node->keys[pos] = value;
+    node->count++;
+    length++;
+    return true;
+}
+
+bool BSkipList::deleteNode(int value) {
+    Node* node = findBlock(value);
+    if (node == header) {
+        return false;
+    }
+    int pos = countLess(node->keys, value);
+    if (pos >= node->count || node->keys[pos] != value) {
+        return false;
+    }
+
+    memmove(node->keys + pos, node->keys + pos + 1, (node->count - pos - 1) * sizeof(int));
+    node->count--;
+    node->keys[node->count] = INT_MAX;
+    length--;
+
+    if (node->count == 0) {
+        // The emptied node's smallest key is now INT_MAX, so a descent for
+        // nodes with smallest key < value stops just before it at each level
+        Node* current = header;
+        for (int i = level - 1; i >= 0; i--) {
+            while (current->forward[i] && current->forward[i]->keys[0] < value) {
+                current = current->forward[i];
+            }
+            if (current->forward[i] == node) {
+                current->forward[i] = node->forward[i];
+            }
+        }
+        while (level > 0 && header->forward[level - 1] == nullptr) {
+            level--;
+        }
+        release(node);
+    }
+    return true;
+}
+
+void BSkipList::printList() {
+    for (int i = 0; i < level; i++) {
+        Node* current = header->forward[i];
+        std::cout << "Level " << i << ":";
+        while (current != nullptr) {
+            std::cout << " [";
+            for (int j = 0; j < current->count; j++) {
+                std::cout << (j > 0 ? " " : "") << current->keys[j];
+            }
+            std::cout << "]";
+            current = current->forward[i];
+        }
+        std::cout << std::endl;
+    }
+}
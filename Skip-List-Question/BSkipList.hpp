@@ -0,0 +1,68 @@
+#ifndef BSKIPLIST_HPP
+#define BSKIPLIST_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Unrolled skip list ("B-skiplist") of distinct ints. Each node holds a
+// sorted block of up to BLOCK keys and is indexed by its smallest key; a
+// search descends the levels comparing only those, then finds the key within
+// one block with SIMD comparisons. Compared with SkipList, a level-0 walk
+// touches a node per BLOCK keys rather than per key.
+//
+// A hop is not one cache line: the 64 bytes of keys come first, and count,
+// level and the links follow on the next line, so a hop that moves onto a
+// node touches both. Over random hits among a million keys, a search makes
+// about 31 hops at 1.5 lines each, 42 distinct lines in all. Putting the
+// links first in 64-byte-aligned nodes of 12 keys measured worse (1.7 lines
+// per hop, slower): most hops are on the upper levels, where a tall node's
+// links push its smallest key off the first line.
+//
+// Every key in a node is at least its smallest key and less than the next
+// node's. A full node splits in half, the upper half going to a new node of
+// random level. Nodes are not merged as they shrink; a node is unlinked once
+// its last key is deleted.
+class BSkipList {
+public:
+    static const int BLOCK = 16;
+
+    BSkipList(int maxLevel = 16);
+    ~BSkipList();
+
+    bool search(int value) const;
+    bool insert(int value);       // false if value was already present
+    bool deleteNode(int value);   // false if value was not present
+    void printList();
+
+    int size() const { return length; }
+
+private:
+    struct Node {
+        int keys[BLOCK];   // sorted; unused slots hold INT_MAX
+        int count;
+        int level;
+        Node* forward[1];  // `level` pointers, allocated inline
+    };
+
+    int maxLevel;
+    Node* header;          // no keys
+    int level;
+    int length;            // number of keys
+    uint64_t randomState;
+
+    // Scratch space for insert: the last node at each level whose smallest
+    // key is <= the key being inserted
+    std::vector<Node*> update;
+
+    BSkipList(const BSkipList&);
+    BSkipList& operator=(const BSkipList&);
+
+    static Node* allocate(int level);
+    static void release(Node* node);
+    int randomLevel();
+
+    Node* findBlock(int value) const;
+    void linkAfter(Node* node, Node* prev);
+};
+
+#endif // BSKIPLIST_HPP
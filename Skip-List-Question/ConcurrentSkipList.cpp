@@ -0,0 +1,305 @@
+#include "ConcurrentSkipList.hpp"
+#include <iostream>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+// Pointer tagging: the low bit of a forward pointer marks its node deleted
+static inline bool isMarked(uintptr_t word) {
+    return (word & 1) != 0;
+}
+
+static inline uintptr_t unmarked(uintptr_t word) {
+    return word & ~static_cast<uintptr_t>(1);
+}
+
+// A small index for each live thread, reused after the thread exits, so a
+// list can keep its per-thread records in a fixed array
+class ThreadSlot {
+public:
+    ThreadSlot() {
+        std::lock_guard<std::mutex> guard(lock);
+        for (index = 0; index < static_cast<int>(used.size()) && used[index]; index++) {
+        }
+        if (index == static_cast<int>(used.size())) used.push_back(false);
+        if (index >= ConcurrentSkipList::MAX_THREADS) {
+            std::cerr << "ConcurrentSkipList: more than " << ConcurrentSkipList::MAX_THREADS
+                      << " threads" << std::endl;
+            std::abort();
+        }
+        used[index] = true;
+        if (index >= highWater.load()) highWater.store(index + 1);
+    }
+
+    ~ThreadSlot() {
+        std::lock_guard<std::mutex> guard(lock);
+        used[index] = false;
+    }
+
+    int index;
+    static std::atomic<int> highWater;     // one past the largest index handed out
+
+private:
+    static std::mutex lock;
+    static std::vector<bool> used;
+};
+
+std::atomic<int> ThreadSlot::highWater(0);
+std::mutex ThreadSlot::lock;
+std::vector<bool> ThreadSlot::used;
+
+static thread_local ThreadSlot threadSlot;
+
+ConcurrentSkipList::EpochGuard::EpochGuard(ConcurrentSkipList& list) : record(list.records[threadSlot.index]) {
+    record.epoch.store((list.globalEpoch.load() << 1) | 1);
+}
+
+ConcurrentSkipList::EpochGuard::~EpochGuard() {
+    record.epoch.store(0);
+}
+
+ConcurrentSkipList::ConcurrentSkipList(int maxLevel) : globalEpoch(0) {
+    this->maxLevel = maxLevel < 1 ? 1 : (maxLevel > MAX_LEVEL ? MAX_LEVEL : maxLevel);
+    head = allocate(0, this->maxLevel);
+}
+
+ConcurrentSkipList::~ConcurrentSkipList() {
+    // No other thread is using the list, so every node is either still
+    // linked at level 0 or waiting in some thread's limbo list
+    Node* current = head;
+    while (current != nullptr) {
+        Node* next = reinterpret_cast<Node*>(unmarked(current->next[0].load()));
+        release(current);
+        current = next;
+    }
+    for (int i = 0; i < MAX_THREADS; i++) {
+        for (size_t j = 0; j < records[i].limbo.size(); j++) {
+            release(records[i].limbo[j].first);
+        }
+    }
+}
+
+ConcurrentSkipList::Node* ConcurrentSkipList::allocate(int value, int level) {
+    size_t bytes = offsetof(Node, next) + level * sizeof(std::atomic<uintptr_t>);
+    Node* node = static_cast<Node*>(::operator new(bytes));
+    node->value = value;
+    node->level = level;
+    new (&node->done) std::atomic<uint8_t>(0);
+    for (int i = 0; i < level; i++) {
+        new (&node->next[i]) std::atomic<uintptr_t>(0);
+    }
+    return node;
+}
+
+void ConcurrentSkipList::release(Node* node) {
+    ::operator delete(node);
+}
+
+// xorshift64* per thread; each level is kept with probability 1/2
+int ConcurrentSkipList::randomLevel(int maxLevel) {
+    static thread_local uint64_t state = 0;
+    if (state == 0) {
+        state = 0x9e3779b97f4a7c15ULL * (threadSlot.index + 1);
+    }
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    uint64_t bits = state * 0x2545f4914f6cdd1dULL;
+
+    int lvl = 1;
+    while ((bits & 1) != 0 && lvl < maxLevel) {
+        bits >>= 1;
+        lvl++;
+    }
+    return lvl;
+}
+
+// Fill preds and succs with value's neighbours at every level, unlinking any
+// marked node passed on the way. Returns whether an unmarked node holding
+// value is linked at level 0 (it is then succs[0]).
+bool ConcurrentSkipList::find(int value, Node** preds, Node** succs) {
+retry:
+    Node* pred = head;
+    for (int i = maxLevel - 1; i >= 0; i--) {
+        Node* current = reinterpret_cast<Node*>(unmarked(pred->next[i].load()));
+        while (current != nullptr) {
+            uintptr_t succ = current->next[i].load();
+            if (isMarked(succ)) {
+                // Snip the deleted node; if pred changed under us, start over
+                uintptr_t expected = reinterpret_cast<uintptr_t>(current);
+                if (!pred->next[i].compare_exchange_strong(expected, unmarked(succ))) {
+                    goto retry;
+                }
+                current = reinterpret_cast<Node*>(unmarked(succ));
+            } else if (current->value < value) {
+                pred = current;
+                current = reinterpret_cast<Node*>(succ);
+            } else {
+                break;
+            }
+        }
+        preds[i] = pred;
+        succs[i] = current;
+    }
+    return succs[0] != nullptr && succs[0]->value == value;
+}
+
+bool ConcurrentSkipList::search(int value) {
+    EpochGuard guard(*this);
+
+    // Read-only: marked nodes are stepped over rather than unlinked
+    Node* pred = head;
+    Node* current = nullptr;
+    for (int i = maxLevel - 1; i >= 0; i--) {
+        current = reinterpret_cast<Node*>(unmarked(pred->next[i].load()));
+        while (current != nullptr) {
+            uintptr_t succ = current->next[i].load();
+            if (isMarked(succ)) {
+                current = reinterpret_cast<Node*>(unmarked(succ));
+            } else if (current->value < value) {
+                pred = current;
+                current = reinterpret_cast<Node*>(succ);
+            } else {
+                break;
+            }
+        }
+    }
+    return current != nullptr && current->value == value;
+}
+
+bool ConcurrentSkipList::insert(int value) {
+    EpochGuard guard(*this);
+    Node* preds[MAX_LEVEL];
+    Node* succs[MAX_LEVEL];
+    int topLevel = randomLevel(maxLevel);
+    Node* node = nullptr;
+
+    while (true) {
+        if (find(value, preds, succs)) {
+            // node was never published, so nobody else can have seen it
+            if (node != nullptr) release(node);
+            return false;
+        }
+        if (node == nullptr) node = allocate(value, topLevel);
+        for (int i = 0; i < topLevel; i++) {
+            node->next[i].store(reinterpret_cast<uintptr_t>(succs[i]));
+        }
+
+        // Linking level 0 is what makes the node part of the list
+        uintptr_t expected = reinterpret_cast<uintptr_t>(succs[0]);
+        if (preds[0]->next[0].compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(node))) {
+            break;
+        }
+    }
+
+    // Link the upper levels. A concurrent delete may mark the node at any
+    // point; once it has, stop linking and leave the cleanup to finish().
+    for (int i = 1; i < topLevel; i++) {
+        while (true) {
+            // Point the node at the current successor first: after a retry
+            // succs[i] may differ from what was stored before level 0 was
+            // linked, and the old successor may since have been freed. Only
+            // a delete changes the node's own pointers, so a failed exchange
+            // means it has been marked.
+            uintptr_t old = node->next[i].load();
+            uintptr_t succ = reinterpret_cast<uintptr_t>(succs[i]);
+            if (isMarked(old) || (old != succ && !node->next[i].compare_exchange_strong(old, succ))) {
+                goto linked;
+            }
+
+            uintptr_t expected = succ;
+            if (preds[i]->next[i].compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(node))) {
+                break;
+            }
+            find(value, preds, succs);
+            if (succs[0] != node) goto linked;   // already deleted and unlinked
+        }
+    }
+linked:
+    finish(node, INSERT_DONE, preds, succs);
+    return true;
+}
+
+bool ConcurrentSkipList::deleteNode(int value) {
+    EpochGuard guard(*this);
+    Node* preds[MAX_LEVEL];
+    Node* succs[MAX_LEVEL];
+
+    if (!find(value, preds, succs)) {
+        return false;
+    }
+    Node* node = succs[0];
+
+    // Mark the upper levels top-down, then level 0, which decides the winner
+    for (int i = node->level - 1; i >= 1; i--) {
+        uintptr_t succ = node->next[i].load();
+        while (!isMarked(succ)) {
+            node->next[i].compare_exchange_weak(succ, succ | 1);
+        }
+    }
+    uintptr_t succ = node->next[0].load();
+    while (true) {
+        if (isMarked(succ)) {
+            return false;   // another thread deleted it first
+        }
+        if (node->next[0].compare_exchange_weak(succ, succ | 1)) {
+            break;
+        }
+    }
+    finish(node, DELETE_DONE, preds, succs);
+    return true;
+}
+
+// Record that the inserter or the deleter of node is done with it. The
+// second one to finish unlinks it from every level (the inserter can no
+// longer relink it) and retires it.
+void ConcurrentSkipList::finish(Node* node, uint8_t step, Node** preds, Node** succs) {
+    if ((node->done.fetch_or(step) | step) != (INSERT_DONE | DELETE_DONE)) {
+        return;
+    }
+    find(node->value, preds, succs);
+    retire(node);
+}
+
+void ConcurrentSkipList::retire(Node* node) {
+    ThreadRecord& record = records[threadSlot.index];
+    record.limbo.push_back(std::make_pair(node, globalEpoch.load()));
+    if (record.limbo.size() % RECLAIM_BATCH == 0) {
+        reclaim(record);
+    }
+}
+
+// Advance the global epoch if every thread in a critical section has seen
+// the current one, then free this thread's nodes retired two epochs ago
+void ConcurrentSkipList::reclaim(ThreadRecord& record) {
+    uint64_t epoch = globalEpoch.load();
+    bool advance = true;
+    for (int i = 0; i < ThreadSlot::highWater.load() && advance; i++) {
+        uint64_t announced = records[i].epoch.load();
+        advance = (announced & 1) == 0 || (announced >> 1) == epoch;
+    }
+    if (advance) {
+        globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+    }
+
+    epoch = globalEpoch.load();
+    size_t freed = 0;
+    while (freed < record.limbo.size() && record.limbo[freed].second + 2 <= epoch) {
+        release(record.limbo[freed].first);
+        freed++;
+    }
+    record.limbo.erase(record.limbo.begin(), record.limbo.begin() + freed);
+}
+
+void ConcurrentSkipList::printList() {
+    for (int i = 0; i < maxLevel; i++) {
+        Node* current = reinterpret_cast<Node*>(unmarked(head->next[i].load()));
+        if (current == nullptr) break;
+        std::cout << "Level " << i << ": ";
+        while (current != nullptr) {
+            std::cout << current->value << " ";
+            current = reinterpret_cast<Node*>(unmarked(current->next[i].load()));
+        }
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef CONCURRENTSKIPLIST_HPP
+#define CONCURRENTSKIPLIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Lock-free skip list of distinct ints, after Herlihy and Shavit's
+// LockFreeSkipList (itself based on Fraser's). Every thread may call search,
+// insert and deleteNode at the same time.
+//
+// A node is deleted by setting the low bit ("mark") of each of its forward
+// pointers, top level first; whoever marks level 0 has deleted it. Marked
+// nodes are unlinked by any later traversal that passes them, so removal
+// needs no locks. Unlinked nodes are freed with epoch-based reclamation: a
+// node retired in epoch e is freed once the global epoch reaches e + 2, by
+// which point every thread that could still hold a pointer to it has left
+// its critical section.
+//
+// Levels are drawn with probability 1/2 from a per-thread generator.
+// printList is only safe while no other thread is using the list.
+class ConcurrentSkipList {
+public:
+    static const int MAX_LEVEL = 32;
+    static const int MAX_THREADS = 256;   // threads using the list at once
+
+    ConcurrentSkipList(int maxLevel = 16);
+    ~ConcurrentSkipList();
+
+    bool search(int value);
+    bool insert(int value);       // false if value was already present
+    bool deleteNode(int value);   // false if value was not present
+    void printList();
+
+private:
+    struct Node {
+        int value;
+        int level;
+        std::atomic<uint8_t> done;             // INSERT_DONE | DELETE_DONE
+        std::atomic<uintptr_t> next[1];        // `level` marked pointers, allocated inline
+    };
+
+    // Per-thread epoch announcement and nodes waiting to be freed
+    struct alignas(64) ThreadRecord {
+        std::atomic<uint64_t> epoch;           // (epoch << 1) | 1 inside a critical section, else 0
+        std::vector<std::pair<Node*, uint64_t> > limbo;
+
+        ThreadRecord() : epoch(0) {}
+    };
+
+    // Marks the calling thread as inside a critical section of list
+    class EpochGuard {
+    public:
+        EpochGuard(ConcurrentSkipList& list);
+        ~EpochGuard();
+    private:
+        ThreadRecord& record;
+    };
+
+    static const uint8_t INSERT_DONE = 1;
+    static const uint8_t DELETE_DONE = 2;
+    static const size_t RECLAIM_BATCH = 64;    // retirements between reclamation attempts
+
+    int maxLevel;
+    Node* head;
+    std::atomic<uint64_t> globalEpoch;
+    ThreadRecord records[MAX_THREADS];
+
+    ConcurrentSkipList(const ConcurrentSkipList&);
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&);
+
+    static Node* allocate(int value, int level);
+    static void release(Node* node);
+    static int randomLevel(int maxLevel);
+
+    bool find(int value, Node** preds, Node** succs);
+    void finish(Node* node, uint8_t step, Node** preds, Node** succs);
+    void retire(Node* node);
+    void reclaim(ThreadRecord& record);
+};
+
+#endif // CONCURRENTSKIPLIST_HPP
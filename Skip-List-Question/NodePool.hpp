@@ -0,0 +1,75 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Per-list node allocator. Nodes are carved out of large slabs obtained from
+// Allocator, and a freed node goes on a free list for its level so the next
+// node of that level reuses it. Everything is released at once when the pool
+// is destroyed.
+//
+// The pool only manages a node's links; constructing and destroying the
+// node's entry is up to the list.
+template <typename Node, typename Allocator>
+class NodePool {
+private:
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<char> CharAllocator;
+
+    static const size_t SLAB_SIZE = 64 * 1024;
+
+    CharAllocator allocator;
+    std::vector<std::pair<char*, size_t> > slabs;
+    char* next;                              // unused space in the newest slab
+    char* end;
+    std::vector<Node*> freeLists;            // one per level, linked through forward[0]
+
+    NodePool(const NodePool&);
+    NodePool& operator=(const NodePool&);
+
+public:
+    NodePool(int maxLevel, const Allocator& allocator)
+        : allocator(allocator), next(nullptr), end(nullptr), freeLists(maxLevel + 1, nullptr) {}
+
+    ~NodePool() {
+        for (size_t i = 0; i < slabs.size(); i++) {
+            allocator.deallocate(slabs[i].first, slabs[i].second);
+        }
+    }
+
+    // A node with `level` null links of width 0
+    Node* allocate(int level) {
+        Node* node;
+        if (freeLists[level] != nullptr) {
+            node = freeLists[level];
+            freeLists[level] = node->forward[0];
+        } else {
+            size_t bytes = Node::bytesFor(level);
+            if (next == nullptr || static_cast<size_t>(end - next) < bytes) {
+                // Start a new slab; a node bigger than a slab gets one of its own
+                size_t slabBytes = bytes > SLAB_SIZE ? bytes : SLAB_SIZE;
+                slabs.push_back(std::make_pair(allocator.allocate(slabBytes), slabBytes));
+                next = slabs.back().first;
+                end = next + slabBytes;
+            }
+            node = reinterpret_cast<Node*>(next);
+            next += bytes;
+        }
+
+        node->level = level;
+        for (int i = 0; i < level; i++) {
+            node->forward[i] = nullptr;
+            node->width()[i] = 0;
+        }
+        return node;
+    }
+
+    void release(Node* node) {
+        node->forward[0] = freeLists[node->level];
+        freeLists[node->level] = node;
+    }
+};
+
+#endif // NODEPOOL_HPP
@@ -1,24 +1,599 @@
 #ifndef SKIPLIST_HPP
 #define SKIPLIST_HPP
 
+#include "NodePool.hpp"
 #include "SkipListNode.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+// Ordered map from K to V with distinct keys, ordered by Compare. With the
+// default V, SkipListEmpty, it holds only keys and each node carries no
+// value. Nodes come from a NodePool that gets its memory from Allocator.
+//
+// Everything is in this header so that the comparisons inline: SkipList<int>
+// with std::less<int> runs the same loops as a list written for int alone.
+//
+// Levels come from the list's own xorshift64* generator, which starts from
+// a fixed seed so runs are reproducible; call seed() to vary them.
+template <typename K, typename V = SkipListEmpty, typename Compare = std::less<K>,
+          typename Allocator = std::allocator<std::pair<const K, V> > >
 class SkipList {
+public:
+    typedef SkipListNode<K, V> Node;
+    typedef typename Node::Entry Entry;
+
 private:
     int maxLevel;
     float probability;
-    SkipListNode* header;
+    Compare compare;
+    NodePool<Node, Allocator> pool;   // every node of this list, header included
+    Node* header;                     // links only; it has no entry
     int level;
+    int length;                       // number of keys
+
+    // Level generation: one random word per node. When probability is 1/2^k
+    // the level is its trailing zero count over k; otherwise the word is
+    // compared against promoteBelow, where promoteBelow[i] is probability^(i+1)
+    // scaled to 2^64, so a word below it reaches at least level i + 2
+    uint64_t randomState;
+    int levelShift;                   // k, or 0 to use promoteBelow
+    std::vector<uint64_t> promoteBelow;
+
+    // The last node before the most recent insert or delete target at each
+    // level, and that node's position (header = 0). Every change to the list
+    // leaves this a valid path, so it doubles as the finger that finger
+    // searches resume from.
+    std::vector<Node*> update;
+    std::vector<int> updateRank;
+
+    SkipList(const SkipList&);
+    SkipList& operator=(const SkipList&);
+
+    Node* firstNotLess(const K& key, bool orEqual) const;
+    Node* nodeAt(int k) const;
+
+    void findUpdate(const K& key, bool resume);
+    bool beforeKey(const Node* node, const K& key) const { return node == header || compare(node->key(), key); }
+    bool foundAfterUpdate(const K& key) const;
+    template <typename... Args>
+    Node* makeNode(const K& key, Args&&... args);
+    void linkAfterUpdate(Node* newNode);
+    void closeLevels();
+
+    // insert_many and build_from_sorted take either keys or (key, value)
+    // pairs
+    static const K& keyOf(const K& key) { return key; }
+    template <typename A, typename B>
+    static const A& keyOf(const std::pair<A, B>& element) { return element.first; }
+    Node* makeNodeFrom(const K& key) { return makeNode(key); }
+    template <typename A, typename B>
+    Node* makeNodeFrom(const std::pair<A, B>& element) { return makeNode(element.first, element.second); }
+    template <typename A, typename B>
+    Node* makeNodeFrom(std::pair<A, B>&& element) { return makeNode(element.first, std::move(element.second)); }
 
 public:
-    SkipList(int maxLevel = 16, float probability = 0.5);
+    // Forward iterator in ascending key order (level 0). It yields the key
+    // for a key-only list and the entry for a key/value list; the key is
+    // read-only either way, since changing it would break the ordering.
+    class iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename Entry::reference reference;
+        typedef typename std::remove_reference<reference>::type* pointer;
+        typedef typename std::remove_const<typename std::remove_reference<reference>::type>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+
+        iterator() : node(nullptr) {}
+        explicit iterator(Node* node) : node(node) {}
 
+        reference operator*() const { return node->entry().get(); }
+        pointer operator->() const { return &node->entry().get(); }
+        iterator& operator++() { node = node->forward[0]; return *this; }
+        iterator operator++(int) { iterator old = *this; node = node->forward[0]; return old; }
+        bool operator==(const iterator& other) const { return node == other.node; }
+        bool operator!=(const iterator& other) const { return node != other.node; }
+
+    private:
+        Node* node;
+    };
+    typedef iterator const_iterator;
+
+    // A pair of iterators usable in a range-based for loop
+    struct Range {
+        iterator first;
+        iterator last;
+
+        iterator begin() const { return first; }
+        iterator end() const { return last; }
+    };
+
+    SkipList(int maxLevel = 16, float probability = 0.5, const Compare& compare = Compare(),
+             const Allocator& allocator = Allocator());
+    ~SkipList();
+
+    static const uint64_t DEFAULT_SEED = 0x9e3779b97f4a7c15ULL;
+
+    void seed(uint64_t seed) { randomState = seed != 0 ? seed : DEFAULT_SEED; }
     int randomLevel();
-    SkipListNode* search(int value);
-    void insert(int value);
-    void deleteNode(int value);
+    Node* search(const K& key);   // null if key is not present
+
+    // Like search and emplace, but starting from the path of the last
+    // insert, delete or finger search rather than from the header. A key d
+    // positions from the previous one costs O(log d) in either direction,
+    // which suits sequential access such as advancing cursors; for random
+    // keys, search is faster.
+    Node* finger_search(const K& key);
+    template <typename... Args>
+    bool finger_emplace(const K& key, Args&&... args);
+
+    // Each returns false, leaving the list unchanged, if key is already
+    // present. emplace constructs the value in place from args, so V may be
+    // move-only.
+    template <typename... Args>
+    bool emplace(const K& key, Args&&... args);
+    bool insert(const K& key) { return emplace(key); }
+    bool insert(const K& key, const V& value) { return emplace(key, value); }
+    bool insert(const K& key, V&& value) { return emplace(key, std::move(value)); }
+
+    // Inserts a batch of keys or (key, value) pairs, sorting it first so each
+    // key's search resumes from the one before; returns how many were new.
+    // A key d positions past the previous one costs O(log d), so a dense
+    // batch loads in close to O(m) after the O(m log m) sort.
+    template <typename InputIt>
+    int insert_many(InputIt first, InputIt last);
+
+    // Replaces the contents with keys or (key, value) pairs given in
+    // ascending order, building every level in one pass in O(n). A key that
+    // is not greater than the one before it is skipped.
+    template <typename InputIt>
+    void build_from_sorted(InputIt first, InputIt last);
+
+    void deleteNode(const K& key);
+    void clear();
     void printList();
+
+    int size() const { return length; }
+
+    // Order statistics, kept in O(log n) by the link widths: rank is the
+    // number of keys less than key, select(k) the k-th smallest key (from
+    // 0), or end() if k is out of range
+    int rank(const K& key) const;
+    iterator select(int k) const { return iterator(nodeAt(k)); }
+    bool deleteByRank(int k);   // false if k is out of range
+
+    iterator begin() const { return iterator(header->forward[0]); }
+    iterator end() const { return iterator(); }
+    iterator lower_bound(const K& key) const;   // first key >= key
+    iterator upper_bound(const K& key) const;   // first key > key
+    // Keys in [lo, hi), found with one descent per bound, so a scan costs
+    // O(log n + k) for k results
+    Range range(const K& lo, const K& hi) const;
 };
 
+template <typename K, typename V, typename Compare, typename Allocator>
+SkipList<K, V, Compare, Allocator>::SkipList(int maxLevel, float probability, const Compare& compare,
+                                             const Allocator& allocator)
+    : compare(compare), pool(maxLevel, allocator), updateRank(maxLevel, 0) {
+    this->maxLevel = maxLevel;
+    this->probability = probability;
+    this->level = 0;
+    this->length = 0;
+    seed(DEFAULT_SEED);
+
+    // probability is 1/2^k exactly when its mantissa is 1/2
+    int exponent;
+    bool powerOfHalf = std::frexp(probability, &exponent) == 0.5f && exponent <= 0 && exponent > -63;
+    levelShift = powerOfHalf ? 1 - exponent : 0;
+    for (int i = 0; i + 1 < maxLevel; i++) {
+        double scaled = std::ldexp(std::pow(static_cast<double>(probability), i + 1), 64);
+        promoteBelow.push_back(scaled >= std::ldexp(1.0, 64) ? UINT64_MAX : static_cast<uint64_t>(scaled));
+    }
+
+    // Create a header node with a maximum level and no entry
+    header = pool.allocate(maxLevel);
+    update.assign(maxLevel, header);
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+const uint64_t SkipList<K, V, Compare, Allocator>::DEFAULT_SEED;
+
+template <typename K, typename V, typename Compare, typename Allocator>
+SkipList<K, V, Compare, Allocator>::~SkipList() {
+    // The pool frees the memory; the entries still need destroying
+    Node* current = header->forward[0];
+    while (current != nullptr) {
+        Node* next = current->forward[0];
+        current->entry().~Entry();
+        current = next;
+    }
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+int SkipList<K, V, Compare, Allocator>::randomLevel() {
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    uint64_t bits = randomState * 0x2545f4914f6cdd1dULL;
+
+    int lvl;
+    if (levelShift != 0) {
+        lvl = 1 + __builtin_ctzll(bits | (1ULL << 63)) / levelShift;
+    } else {
+        lvl = 1;
+        while (lvl < maxLevel && bits < promoteBelow[lvl - 1]) {
+            lvl++;
+        }
+    }
+    return lvl < maxLevel ? lvl : maxLevel;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::Node* SkipList<K, V, Compare, Allocator>::search(const K& key) {
+    Node* current = header;
+    for (int i = level - 1; i >= 0; i--) {
+        while (current->forward[i] && compare(current->forward[i]->key(), key)) {
+            current = current->forward[i];
+        }
+    }
+    current = current->forward[0];  // Move to the next node at level 0
+    return (current && !compare(key, current->key())) ? current : nullptr;
+}
+
+// First node whose key is >= key (> key unless orEqual), or null
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::Node*
+SkipList<K, V, Compare, Allocator>::firstNotLess(const K& key, bool orEqual) const {
+    Node* current = header;
+    for (int i = level - 1; i >= 0; i--) {
+        while (current->forward[i] &&
+               (compare(current->forward[i]->key(), key) ||
+                (!orEqual && !compare(key, current->forward[i]->key())))) {
+            current = current->forward[i];
+        }
+    }
+    return current->forward[0];
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::iterator
+SkipList<K, V, Compare, Allocator>::lower_bound(const K& key) const {
+    return iterator(firstNotLess(key, true));
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::iterator
+SkipList<K, V, Compare, Allocator>::upper_bound(const K& key) const {
+    return iterator(firstNotLess(key, false));
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::Range
+SkipList<K, V, Compare, Allocator>::range(const K& lo, const K& hi) const {
+    Range r;
+    r.first = lower_bound(lo);
+    r.last = compare(lo, hi) ? lower_bound(hi) : r.first;
+    return r;
+}
+
+// Fill update and updateRank with the last node before key at each level.
+// With resume, the previous path is reused. A level whose path node is
+// before key and whose next node is not keeps its entry, and so does every
+// level above it, so only the levels below the lowest such level are
+// walked, each from the previous path where that is before key and further
+// along: O(log d) for a key d positions from the last one.
+template <typename K, typename V, typename Compare, typename Allocator>
+void SkipList<K, V, Compare, Allocator>::findUpdate(const K& key, bool resume) {
+    int top = level;
+    if (resume) {
+        top = 0;
+        while (top < level && (!beforeKey(update[top], key) ||
+                               (update[top]->forward[top] && compare(update[top]->forward[top]->key(), key)))) {
+            top++;
+        }
+    }
+
+    Node* current = top < level ? update[top] : header;
+    int position = top < level ? updateRank[top] : 0;
+    for (int i = top - 1; i >= 0; i--) {
+        if (resume && updateRank[i] > position && beforeKey(update[i], key)) {
+            current = update[i];
+            position = updateRank[i];
+        }
+        while (current->forward[i] && compare(current->forward[i]->key(), key)) {
+            position += current->width()[i];
+            current = current->forward[i];
+        }
+        update[i] = current;
+        updateRank[i] = position;
+    }
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::Node*
+SkipList<K, V, Compare, Allocator>::finger_search(const K& key) {
+    findUpdate(key, true);
+    return foundAfterUpdate(key) ? update[0]->forward[0] : nullptr;
+}
+
+// Whether the path in update ends just before key
+template <typename K, typename V, typename Compare, typename Allocator>
+bool SkipList<K, V, Compare, Allocator>::foundAfterUpdate(const K& key) const {
+    Node* next = level > 0 ? update[0]->forward[0] : nullptr;
+    return next != nullptr && !compare(key, next->key());
+}
+
+// A node of random level holding a new entry, not yet linked in. If the
+// entry's constructor throws, the node goes back to the pool.
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename... Args>
+typename SkipList<K, V, Compare, Allocator>::Node*
+SkipList<K, V, Compare, Allocator>::makeNode(const K& key, Args&&... args) {
+    Node* node = pool.allocate(randomLevel());
+    try {
+        new (&node->entry()) Entry(key, std::forward<Args>(args)...);
+    } catch (...) {
+        pool.release(node);
+        throw;
+    }
+    return node;
+}
+
+// Link newNode in after the path in update, then leave the path ending at
+// newNode so the next greater key can resume from it
+template <typename K, typename V, typename Compare, typename Allocator>
+void SkipList<K, V, Compare, Allocator>::linkAfterUpdate(Node* newNode) {
+    int newLevel = newNode->level;
+
+    // Update the level of the skip list if necessary; the header's new
+    // levels skip straight past the end
+    if (newLevel > level) {
+        for (int i = level; i < newLevel; i++) {
+            update[i] = header;
+            updateRank[i] = 0;
+            header->width()[i] = length + 1;
+        }
+        level = newLevel;
+    }
+
+    // Update the forward pointers for the new node and the nodes in the
+    // update list, splitting each spanned link's width around the new node
+    int position = updateRank[0] + 1;
+    for (int i = 0; i < newLevel; i++) {
+        newNode->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = newNode;
+        newNode->width()[i] = update[i]->width()[i] - (position - updateRank[i]) + 1;
+        update[i]->width()[i] = position - updateRank[i];
+        update[i] = newNode;
+        updateRank[i] = position;
+    }
+
+    // Links above the new node now skip one more key
+    for (int i = newLevel; i < level; i++) {
+        update[i]->width()[i]++;
+    }
+    length++;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename... Args>
+bool SkipList<K, V, Compare, Allocator>::emplace(const K& key, Args&&... args) {
+    // Find the insertion point for each level, and its position
+    findUpdate(key, false);
+
+    // If the node already exists, don't insert it
+    if (foundAfterUpdate(key)) {
+        return false;
+    }
+
+    linkAfterUpdate(makeNode(key, std::forward<Args>(args)...));
+    return true;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename... Args>
+bool SkipList<K, V, Compare, Allocator>::finger_emplace(const K& key, Args&&... args) {
+    findUpdate(key, true);
+    if (foundAfterUpdate(key)) {
+        return false;
+    }
+    linkAfterUpdate(makeNode(key, std::forward<Args>(args)...));
+    return true;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename InputIt>
+int SkipList<K, V, Compare, Allocator>::insert_many(InputIt first, InputIt last) {
+    typedef typename std::iterator_traits<InputIt>::value_type Element;
+
+    // Sort pointers rather than the elements, which may not be assignable
+    // (pairs with a const key); stable, so the first of equal keys wins
+    std::vector<Element> batch(first, last);
+    std::vector<Element*> order(batch.size());
+    for (size_t i = 0; i < batch.size(); i++) {
+        order[i] = &batch[i];
+    }
+    std::stable_sort(order.begin(), order.end(), [this](const Element* a, const Element* b) {
+        return compare(keyOf(*a), keyOf(*b));
+    });
+
+    // Each key resumes from the path of the one before it
+    int inserted = 0;
+    for (size_t i = 0; i < order.size(); i++) {
+        const K& key = keyOf(*order[i]);
+        if (i > 0 && !compare(keyOf(*order[i - 1]), key)) {
+            continue;
+        }
+        findUpdate(key, true);
+        if (!foundAfterUpdate(key)) {
+            linkAfterUpdate(makeNodeFrom(std::move(*order[i])));
+            inserted++;
+        }
+    }
+    return inserted;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename InputIt>
+void SkipList<K, V, Compare, Allocator>::build_from_sorted(InputIt first, InputIt last) {
+    clear();
+
+    // update[i] is the last node so far with level > i, and updateRank[i]
+    // its position; each new node is linked in after them at its levels
+    for (int i = 0; i < maxLevel; i++) {
+        update[i] = header;
+        updateRank[i] = 0;
+    }
+    try {
+        for (; first != last; ++first) {
+            if (length > 0 && !compare(update[0]->key(), keyOf(*first))) {
+                continue;
+            }
+            Node* node = makeNodeFrom(*first);
+            int position = length + 1;
+            for (int i = 0; i < node->level; i++) {
+                update[i]->forward[i] = node;
+                update[i]->width()[i] = position - updateRank[i];
+                update[i] = node;
+                updateRank[i] = position;
+            }
+            if (node->level > level) {
+                level = node->level;
+            }
+            length++;
+        }
+    } catch (...) {
+        closeLevels();
+        throw;
+    }
+    closeLevels();
+}
+
+// After build_from_sorted: the last link at each level skips to the end
+template <typename K, typename V, typename Compare, typename Allocator>
+void SkipList<K, V, Compare, Allocator>::closeLevels() {
+    for (int i = 0; i < level; i++) {
+        update[i]->width()[i] = length + 1 - updateRank[i];
+    }
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+void SkipList<K, V, Compare, Allocator>::clear() {
+    Node* current = header->forward[0];
+    while (current != nullptr) {
+        Node* next = current->forward[0];
+        current->entry().~Entry();
+        pool.release(current);
+        current = next;
+    }
+    for (int i = 0; i < maxLevel; i++) {
+        header->forward[i] = nullptr;
+        header->width()[i] = 0;
+        update[i] = header;
+        updateRank[i] = 0;
+    }
+    level = 0;
+    length = 0;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+void SkipList<K, V, Compare, Allocator>::deleteNode(const K& key) {
+    // Find the node to delete
+    findUpdate(key, false);
+
+    // Move to the next node at level 0
+    Node* current = level > 0 ? update[0]->forward[0] : nullptr;
+
+    // If the node is not found, return
+    if (current == nullptr || compare(key, current->key())) {
+        std::cout << "Node not found!" << std::endl;
+        return;
+    }
+
+    // Update the forward pointers to remove the node; links that jumped
+    // over it get one shorter
+    for (int i = 0; i < level; i++) {
+        if (update[i]->forward[i] == current) {
+            update[i]->width()[i] += current->width()[i] - 1;
+            update[i]->forward[i] = current->forward[i];
+        } else {
+            update[i]->width()[i]--;
+        }
+    }
+
+    // Decrease the level of the skip list if necessary
+    while (level > 1 && header->forward[level - 1] == nullptr) {
+        level--;
+    }
+    length--;
+
+    // Destroy the entry and return the node to the pool
+    current->entry().~Entry();
+    pool.release(current);
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+int SkipList<K, V, Compare, Allocator>::rank(const K& key) const {
+    Node* current = header;
+    int position = 0;
+    for (int i = level - 1; i >= 0; i--) {
+        while (current->forward[i] && compare(current->forward[i]->key(), key)) {
+            position += current->width()[i];
+            current = current->forward[i];
+        }
+    }
+    return position;
+}
+
+// The node at position k (from 0), or null if k is out of range
+template <typename K, typename V, typename Compare, typename Allocator>
+typename SkipList<K, V, Compare, Allocator>::Node* SkipList<K, V, Compare, Allocator>::nodeAt(int k) const {
+    if (k < 0 || k >= length) {
+        return nullptr;
+    }
+
+    // Walk to position k + 1, counting the header as position 0
+    Node* current = header;
+    int position = 0;
+    for (int i = level - 1; i >= 0; i--) {
+        while (current->forward[i] && position + current->width()[i] <= k + 1) {
+            position += current->width()[i];
+            current = current->forward[i];
+        }
+    }
+    return current;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+bool SkipList<K, V, Compare, Allocator>::deleteByRank(int k) {
+    Node* node = nodeAt(k);
+    if (node == nullptr) {
+        return false;
+    }
+    deleteNode(node->key());
+    return true;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+void SkipList<K, V, Compare, Allocator>::printList() {
+    for (int i = 0; i < level; i++) {
+        Node* current = header->forward[i];
+        std::cout << "Level " << i << ": ";
+        while (current != nullptr) {
+            std::cout << current->key() << " ";
+            current = current->forward[i];
+        }
+        std::cout << std::endl;
+    }
+}
+
 #endif // SKIPLIST_HPP
@@ -1,14 +1,78 @@
 #ifndef SKIPLISTNODE_HPP
 #define SKIPLISTNODE_HPP
 
-#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
+// Stands in for the value type of a SkipList that holds only keys
+struct SkipListEmpty {};
+
+// Key and value of one node. The key is const since changing it in place
+// would break the ordering. An iterator over a key/value list yields the
+// whole entry.
+template <typename K, typename V>
+struct SkipListEntry {
+    typedef SkipListEntry& reference;
+
+    const K key;
+    V value;
+
+    template <typename... Args>
+    SkipListEntry(const K& key, Args&&... args) : key(key), value(std::forward<Args>(args)...) {}
+
+    V& getValue() { return value; }
+    reference get() { return *this; }
+};
+
+// A key-only entry takes no space for its value, and an iterator over a
+// key-only list yields just the key
+template <typename K>
+struct SkipListEntry<K, SkipListEmpty> {
+    typedef const K& reference;
+
+    const K key;
+
+    SkipListEntry(const K& key) : key(key) {}
+
+    reference get() { return key; }
+
+    SkipListEmpty& getValue() {
+        static SkipListEmpty none;
+        return none;
+    }
+};
+
+// A node and its forward pointers are one allocation: forward is declared
+// with one element but the node is allocated with room for `level` of them,
+// followed by `level` link widths, so following a link never goes through a
+// separate array. The entry is constructed separately from the links, so
+// the header node can go without one.
+template <typename K, typename V>
 class SkipListNode {
 public:
-    int value;
-    std::vector<SkipListNode*> forward;
+    typedef SkipListEntry<K, V> Entry;
+
+    int level;
+    typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type storage;
+    SkipListNode* forward[1];
+
+    Entry& entry() { return *reinterpret_cast<Entry*>(&storage); }
+    const Entry& entry() const { return *reinterpret_cast<const Entry*>(&storage); }
+    const K& key() const { return entry().key; }
+    V& value() { return entry().getValue(); }
+
+    // width()[i] is the number of level-0 steps forward[i] skips; for a null
+    // forward pointer, the steps to one past the last node
+    int* width() { return reinterpret_cast<int*>(forward + level); }
+    const int* width() const { return reinterpret_cast<const int*>(forward + level); }
 
-    SkipListNode(int value, int level);
+    // Bytes needed for a node with the given number of levels
+    static size_t bytesFor(int level) {
+        size_t bytes = offsetof(SkipListNode, forward) + level * (sizeof(SkipListNode*) + sizeof(int));
+        size_t align = alignof(SkipListNode);
+        return (bytes + align - 1) / align * align;
+    }
 };
 
 #endif // SKIPLISTNODE_HPP
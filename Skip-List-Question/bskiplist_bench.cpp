@@ -0,0 +1,81 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include "BSkipList.hpp"
+#include "SkipList.hpp"
+
+// Usage: bskiplist_bench [keys]
+// A/B of SkipList against BSkipList: times insert, search (hits and misses)
+// and deleteNode over the same random keys for each.
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* list, const char* phase, double ns, size_t ops) {
+    std::cout << list << " " << phase << ": " << ns / ops << " ns/op" << std::endl;
+}
+
+// SkipList::deleteNode reports missing keys instead of returning, and
+// search returns a node; these give both lists the same shape
+static bool contains(SkipList<int>& list, int value) { return list.search(value) != nullptr; }
+static bool contains(BSkipList& list, int value) { return list.search(value); }
+
+template <typename List>
+static void run(const char* name, List& list, const std::vector<int>& keys, const std::vector<int>& probes) {
+    size_t n = keys.size();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        list.insert(keys[i]);
+    }
+    report(name, "insert", elapsedNs(start), n);
+
+    size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        found += contains(list, probes[i]);
+    }
+    report(name, "search hit", elapsedNs(start), n);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        found += contains(list, probes[i] + 1);
+    }
+    report(name, "search miss", elapsedNs(start), n);
+    if (found != n) std::cerr << name << " found " << found << " of " << n << " keys" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        list.deleteNode(probes[i]);
+    }
+    report(name, "deleteNode", elapsedNs(start), n);
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 10000000;
+
+    // Even keys are inserted, so odd keys are guaranteed misses
+    std::mt19937_64 rng(42);
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = static_cast<int>(2 * i);
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    std::vector<int> probes(keys);
+    std::shuffle(probes.begin(), probes.end(), rng);
+
+    std::cout << n << " keys" << std::endl;
+    {
+        SkipList<int> skipList(24);
+        run("SkipList", skipList, keys, probes);
+    }
+    {
+        BSkipList bSkipList(24);
+        run("BSkipList", bSkipList, keys, probes);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include "ConcurrentSkipList.hpp"
+#include "SkipList.hpp"
+
+// Usage: concurrent_skiplist_bench [max threads] [ops per thread]
+// Prints CSV of ops/sec for the lock-free list and for SkipList behind one
+// mutex, from 1 to max threads, at several read percentages. Writes are
+// split evenly between insert and deleteNode over a key range half filled
+// beforehand, so the list stays about the same size throughout.
+
+static const int KEY_RANGE = 1 << 20;
+
+// The single-lock baseline
+struct LockedSkipList {
+    SkipList<int> list;
+    std::mutex lock;
+
+    LockedSkipList() : list(20) {}
+    bool search(int value) {
+        std::lock_guard<std::mutex> guard(lock);
+        return list.search(value) != nullptr;
+    }
+    bool insert(int value) {
+        std::lock_guard<std::mutex> guard(lock);
+        return list.insert(value);
+    }
+    bool deleteNode(int value) {
+        std::lock_guard<std::mutex> guard(lock);
+        // SkipList::deleteNode reports missing keys, so only delete present ones
+        if (list.search(value) == nullptr) return false;
+        list.deleteNode(value);
+        return true;
+    }
+};
+
+static uint64_t nextRandom(uint64_t& state) {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545f4914f6cdd1dULL;
+}
+
+// Run every thread's mix of operations against list; return ops/sec
+template <typename List>
+double run(List& list, unsigned threads, int readPercent, size_t ops) {
+    std::vector<std::thread> workers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (unsigned t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&list, readPercent, ops, t]() {
+            uint64_t state = 0x9e3779b97f4a7c15ULL * (t + 1);
+            for (size_t i = 0; i < ops; i++) {
+                uint64_t r = nextRandom(state);
+                int key = static_cast<int>(r % KEY_RANGE);
+                int choice = static_cast<int>((r >> 32) % 100);
+                if (choice < readPercent) {
+                    list.search(key);
+                } else if (choice % 2 == 0) {
+                    list.insert(key);
+                } else {
+                    list.deleteNode(key);
+                }
+            }
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return threads * ops / seconds;
+}
+
+template <typename List>
+void fill(List& list) {
+    for (int key = 0; key < KEY_RANGE; key += 2) {
+        list.insert(key);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    unsigned maxThreads = argc > 1 ? atoi(argv[1]) : std::thread::hardware_concurrency();
+    size_t ops = argc > 2 ? strtoul(argv[2], nullptr, 10) : 500000;
+    if (maxThreads == 0) maxThreads = 1;
+
+    int readPercents[] = {100, 90, 50, 10};
+    std::cout << "read_percent,threads,lock_free_ops_per_sec,mutex_ops_per_sec" << std::endl;
+    for (size_t r = 0; r < sizeof(readPercents) / sizeof(readPercents[0]); r++) {
+        for (unsigned threads = 1; threads <= maxThreads; threads++) {
+            ConcurrentSkipList lockFree(20);
+            LockedSkipList locked;
+            fill(lockFree);
+            fill(locked);
+            double a = run(lockFree, threads, readPercents[r], ops);
+            double b = run(locked, threads, readPercents[r], ops);
+            std::cout << readPercents[r] << "," << threads << "," << a << "," << b << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include "SkipList.hpp"
+
+// Usage: finger_bench [keys]
+// Times search against finger_search on sequential probes (ascending with a
+// small random stride, like an advancing cursor) and on random probes, then
+// insert against finger_emplace on ascending keys such as timestamps.
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* workload, const char* method, double ns, size_t ops) {
+    std::cout << workload << " " << method << ": " << ns / ops << " ns/op" << std::endl;
+}
+
+static void timeSearches(const char* workload, SkipList<int>& skipList, const std::vector<int>& probes) {
+    size_t found = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < probes.size(); i++) {
+        found += skipList.search(probes[i]) != nullptr;
+    }
+    report(workload, "search", elapsedNs(start), probes.size());
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < probes.size(); i++) {
+        found -= skipList.finger_search(probes[i]) != nullptr;
+    }
+    report(workload, "finger_search", elapsedNs(start), probes.size());
+    if (found != 0) std::cerr << "search and finger_search disagree" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 10000000;
+    std::mt19937_64 rng(42);
+
+    // Even keys are present; probes hit about half the time
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = static_cast<int>(2 * i);
+    }
+
+    std::vector<int> sequential(n);
+    int cursor = 0;
+    for (size_t i = 0; i < n; i++) {
+        cursor += 1 + static_cast<int>(rng() % 4);
+        sequential[i] = cursor % static_cast<int>(2 * n);
+    }
+    std::vector<int> random(sequential);
+    std::shuffle(random.begin(), random.end(), rng);
+
+    std::cout << n << " keys" << std::endl;
+    {
+        SkipList<int> skipList(24);
+        skipList.build_from_sorted(keys.begin(), keys.end());
+        timeSearches("sequential", skipList, sequential);
+        timeSearches("random", skipList, random);
+    }
+
+    {
+        SkipList<int> skipList(24);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {
+            skipList.insert(keys[i]);
+        }
+        report("ascending", "insert", elapsedNs(start), n);
+    }
+    {
+        SkipList<int> skipList(24);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {
+            skipList.finger_emplace(keys[i]);
+        }
+        report("ascending", "finger_emplace", elapsedNs(start), n);
+    }
+    return 0;
+}
@@ -1,10 +1,11 @@
+#include <ctime>
 #include <iostream>
+#include <string>
 #include "SkipList.hpp"
 
 int main() {
-    srand(time(0)); // Seed for random level generation
-
-    SkipList skipList;
+    SkipList<int> skipList;
+    skipList.seed(time(0)); // Seed for random level generation
 
     // Insert elements
     skipList.insert(3);
@@ -25,7 +26,7 @@ int main() {
     skipList.printList();
 
     // Search for elements
-    SkipListNode* result = skipList.search(6);
+    SkipList<int>::Node* result = skipList.search(6);
     if (result) {
         std::cout << "Found 6 in the skip list." << std::endl;
     } else {
@@ -39,5 +40,28 @@ int main() {
 
     skipList.search(50);
 
+    // Ordered scans
+    std::cout << "Values in [4, 17):";
+    for (int value : skipList.range(4, 17)) {
+        std::cout << " " << value;
+    }
+    std::cout << std::endl;
+    std::cout << "First value >= 10: " << *skipList.lower_bound(10) << std::endl;
+    std::cout << "First value > 17: " << *skipList.upper_bound(17) << std::endl;
+
+    // Order statistics
+    std::cout << "Values less than 12: " << skipList.rank(12) << std::endl;
+    std::cout << "Median of " << skipList.size() << " values: " << *skipList.select(skipList.size() / 2)
+              << std::endl;
+
+    // Key/value pairs; negative keys are ordinary keys
+    SkipList<int, std::string> names;
+    names.insert(-5, "minus five");
+    names.emplace(0, 4, 'z');
+    names.insert(8, "eight");
+    for (SkipListEntry<int, std::string>& entry : names) {
+        std::cout << entry.key << " -> " << entry.value << std::endl;
+    }
+
     return 0;
 }
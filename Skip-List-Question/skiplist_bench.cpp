@@ -0,0 +1,120 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <sys/resource.h>
+#include "SkipList.hpp"
+
+// Usage: skiplist_bench [keys]
+// Times randomLevel, then insert, search (hits and misses) and deleteNode over
+// random keys, then the same keys loaded by insert_many and build_from_sorted,
+// and counts the heap allocations each phase makes.
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void* p = malloc(size);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* phase, double ns, size_t ops, size_t allocs) {
+    std::cout << phase << ": " << ns / ops << " ns/op, " << allocs << " allocations ("
+              << static_cast<double>(allocs) / ops << " per op)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 10000000;
+
+    // Even keys are inserted, so odd keys are guaranteed misses
+    std::mt19937_64 rng(42);
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = static_cast<int>(2 * i);
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    std::vector<int> probes(keys);
+    std::shuffle(probes.begin(), probes.end(), rng);
+
+    std::cout << n << " keys" << std::endl;
+    size_t before = allocations;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    {
+        SkipList<int> skipList(24);
+        long levels = 0;
+        for (size_t i = 0; i < n; i++) {
+            levels += skipList.randomLevel();
+        }
+        report("randomLevel", elapsedNs(start), n, allocations - before);
+        std::cout << "mean level: " << static_cast<double>(levels) / n << std::endl;
+
+        skipList.seed(SkipList<int>::DEFAULT_SEED);
+        before = allocations;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {
+            skipList.insert(keys[i]);
+        }
+        report("insert", elapsedNs(start), n, allocations - before);
+
+        size_t found = 0;
+        before = allocations;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {
+            found += skipList.search(probes[i]) != nullptr;
+        }
+        report("search hit", elapsedNs(start), n, allocations - before);
+
+        before = allocations;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {
+            found += skipList.search(probes[i] + 1) != nullptr;
+        }
+        report("search miss", elapsedNs(start), n, allocations - before);
+        if (found != n) std::cerr << "found " << found << " of " << n << " keys" << std::endl;
+
+        before = allocations;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {
+            skipList.deleteNode(probes[i]);
+        }
+        report("deleteNode", elapsedNs(start), n, allocations - before);
+
+        // Bulk loads into the now-empty list; the batch copy and sort
+        // are part of insert_many's cost
+        before = allocations;
+        start = std::chrono::steady_clock::now();
+        skipList.insert_many(keys.begin(), keys.end());
+        report("insert_many", elapsedNs(start), n, allocations - before);
+        if (skipList.size() != static_cast<int>(n)) std::cerr << "insert_many kept " << skipList.size() << std::endl;
+
+        std::vector<int> sorted(keys);
+        std::sort(sorted.begin(), sorted.end());
+        before = allocations;
+        start = std::chrono::steady_clock::now();
+        skipList.build_from_sorted(sorted.begin(), sorted.end());
+        report("build_from_sorted", elapsedNs(start), n, allocations - before);
+        if (skipList.size() != static_cast<int>(n)) std::cerr << "build_from_sorted kept " << skipList.size() << std::endl;
+    }
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << "peak RSS: " << usage.ru_maxrss / 1024 << " MB" << std::endl;
+    return 0;
+}
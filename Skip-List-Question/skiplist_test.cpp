@@ -0,0 +1,122 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include "SkipList.hpp"
+
+// Usage: skiplist_test [rounds]
+// Checks rank, select and deleteByRank against a sorted std::vector oracle.
+// Each round runs a random mix of insert (duplicates included), deleteNode
+// (absent keys included) and deleteByRank (out-of-range ranks included),
+// interleaved with insert_many, finger_emplace and build_from_sorted, which
+// also maintain the link widths. After every step the list's size, order
+// and every rank and select are compared with the oracle. Exits non-zero at
+// the first mismatch.
+
+static int failures = 0;
+
+static bool fail(int round, int step, const char* what) {
+    std::cerr << "round " << round << ", step " << step << ": " << what << std::endl;
+    failures++;
+    return false;
+}
+
+// Every order statistic of the list against the sorted oracle
+static bool check(const SkipList<int>& skipList, const std::vector<int>& oracle, int round, int step) {
+    if (skipList.size() != static_cast<int>(oracle.size())) return fail(round, step, "size differs");
+
+    int position = 0;
+    for (SkipList<int>::iterator it = skipList.begin(); it != skipList.end(); ++it, position++) {
+        if (*it != oracle[position]) return fail(round, step, "iteration order differs");
+    }
+
+    for (int k = -1; k <= static_cast<int>(oracle.size()); k++) {
+        SkipList<int>::iterator it = skipList.select(k);
+        if (k < 0 || k >= static_cast<int>(oracle.size())) {
+            if (it != skipList.end()) return fail(round, step, "select out of range is not end()");
+        } else if (it == skipList.end() || *it != oracle[k]) {
+            return fail(round, step, "select differs");
+        }
+    }
+
+    // Present keys, the gaps between them and both ends
+    for (size_t i = 0; i <= oracle.size(); i++) {
+        int probes[2] = {i < oracle.size() ? oracle[i] : 1 << 20, i < oracle.size() ? oracle[i] - 1 : -1};
+        for (int j = 0; j < 2; j++) {
+            int expected = std::lower_bound(oracle.begin(), oracle.end(), probes[j]) - oracle.begin();
+            if (skipList.rank(probes[j]) != expected) return fail(round, step, "rank differs");
+        }
+    }
+    return true;
+}
+
+static void insertOracle(std::vector<int>& oracle, int key) {
+    std::vector<int>::iterator it = std::lower_bound(oracle.begin(), oracle.end(), key);
+    if (it == oracle.end() || *it != key) oracle.insert(it, key);
+}
+
+int main(int argc, char* argv[]) {
+    int rounds = argc > 1 ? atoi(argv[1]) : 200;
+    float probabilities[3] = {0.5f, 0.25f, 0.3f};
+
+    for (int round = 0; round < rounds && failures == 0; round++) {
+        std::mt19937 rng(round);
+        SkipList<int> skipList(12, probabilities[round % 3]);
+        skipList.seed(round + 1);
+        std::vector<int> oracle;
+
+        // A small key range, so duplicates and hits on deleteNode are common
+        int keyRange = 20 + rng() % 300;
+
+        for (int step = 0; step < 400 && failures == 0; step++) {
+            int op = rng() % 100;
+            int key = rng() % keyRange;
+
+            if (op < 40) {
+                bool inserted = skipList.insert(key);
+                bool expected = !std::binary_search(oracle.begin(), oracle.end(), key);
+                if (inserted != expected) fail(round, step, "insert result differs");
+                insertOracle(oracle, key);
+            } else if (op < 60) {
+                // deleteNode reports absent keys on stdout; keep that quiet
+                std::streambuf* out = std::cout.rdbuf(nullptr);
+                skipList.deleteNode(key);
+                std::cout.rdbuf(out);
+                std::vector<int>::iterator it = std::lower_bound(oracle.begin(), oracle.end(), key);
+                if (it != oracle.end() && *it == key) oracle.erase(it);
+            } else if (op < 80) {
+                int k = static_cast<int>(rng() % (oracle.size() + 3)) - 1;
+                bool deleted = skipList.deleteByRank(k);
+                bool expected = k >= 0 && k < static_cast<int>(oracle.size());
+                if (deleted != expected) fail(round, step, "deleteByRank result differs");
+                if (expected) oracle.erase(oracle.begin() + k);
+            } else if (op < 88) {
+                skipList.finger_emplace(key);
+                insertOracle(oracle, key);
+            } else if (op < 97) {
+                std::vector<int> batch(rng() % 10);
+                for (size_t i = 0; i < batch.size(); i++) {
+                    batch[i] = rng() % keyRange;
+                    insertOracle(oracle, batch[i]);
+                }
+                skipList.insert_many(batch.begin(), batch.end());
+            } else {
+                std::vector<int> sorted(rng() % 60);
+                for (size_t i = 0; i < sorted.size(); i++) {
+                    sorted[i] = rng() % keyRange;
+                }
+                std::sort(sorted.begin(), sorted.end());
+                skipList.build_from_sorted(sorted.begin(), sorted.end());
+                oracle = sorted;
+                oracle.erase(std::unique(oracle.begin(), oracle.end()), oracle.end());
+            }
+
+            check(skipList, oracle, round, step);
+        }
+    }
+
+    if (failures != 0) return 1;
+    std::cout << "skiplist_test: " << rounds << " rounds passed" << std::endl;
+    return 0;
+}